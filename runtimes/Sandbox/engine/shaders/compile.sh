@@ -5,15 +5,31 @@ cd "$(dirname "$0")"
 # The way morrigu handles shader is by having a list of "modules", each represented by a subfolder here.
 # Each module must present a gl.glsl OpenGL shader, and a vk.frag as well as a vk.vert vulkan equivalent.
 # This script compiles only the vulkan shaders into frag.spv and vert.spv files.
+# The vertex stage of the instanced quad rendering mode only depends on the engine's instance layout, so its single source
+# (src/Morrigu/Renderer/Shaders/vk_instanced.vert) is compiled into the vert_instanced.spv of every module. A module can still
+# present its own vk_instanced.vert instead. The OpenGL equivalent is built into the engine, and is likewise replaced by an
+# "instanced_vertex" section in the module's gl.glsl file.
+# Modules can also present a vk_indexed.frag (compiled into frag_indexed.spv), used instead of vk.frag when the device
+# supports descriptor indexing and textures are all sampled from a single texture table.
 # To add a module, simply add a directory along the others, and it should be handled the same as the others
 # without any other input (as long as needed files are present).
 
 # glslc is included in the vulkan SDK. This script will look for the binary using the environment variable usually set by the official install scripts. 
 
+ENGINE_SHADERS_DIR="../../../../src/Morrigu/Renderer/Shaders"
+
 for D in *; do
     if [ -d "${D}" ]; then
         "${VULKAN_SDK}/bin/glslc" "${D}/vk.vert" -o "${D}/vert.spv"
         "${VULKAN_SDK}/bin/glslc" "${D}/vk.frag" -o "${D}/frag.spv"
+        if [ -f "${D}/vk_instanced.vert" ]; then
+            "${VULKAN_SDK}/bin/glslc" "${D}/vk_instanced.vert" -o "${D}/vert_instanced.spv"
+        else
+            "${VULKAN_SDK}/bin/glslc" "${ENGINE_SHADERS_DIR}/vk_instanced.vert" -o "${D}/vert_instanced.spv"
+        fi
+        if [ -f "${D}/vk_indexed.frag" ]; then
+            "${VULKAN_SDK}/bin/glslc" "${D}/vk_indexed.frag" -o "${D}/frag_indexed.spv"
+        fi
     fi
 done
 
@@ -0,0 +1,17 @@
+// clang-format off
+#version 450
+#extension GL_EXT_nonuniform_qualifier : require
+
+layout(location = 0) in vec4 v_color;
+layout(location = 1) in vec2 v_texCoord;
+layout(location = 2) in flat float v_texIndex;
+layout(location = 3) in float v_tilingFactor;
+layout(location = 4) in flat uint v_objectID;
+
+layout(binding = 1) uniform sampler2D u_textures[4096];
+
+layout(location = 0) out vec4 color;
+
+void main() {
+    color = v_color * texture(u_textures[nonuniformEXT(int(v_texIndex))], v_texCoord * v_tilingFactor);
+}
@@ -8,6 +8,8 @@
 ///
 #include <ImGuizmo.h>
 
+#include <algorithm>
+
 namespace MRG
 {
 	MachaLayer::MachaLayer() : Layer("Sandbox 2D") {}
@@ -188,10 +190,10 @@ namespace MRG
 				glm::vec3 translation, rotation, scale;
 				Maths::decomposeTransform(transform, translation, rotation, scale);
 
-				glm::vec3 deltaRotation = rotation - tc.rotation;
-				tc.translation = translation;
-				tc.rotation += deltaRotation;
-				tc.scale = scale;
+				glm::vec3 deltaRotation = rotation - tc.getRotation();
+				tc.setTranslation(translation);
+				tc.setRotation(tc.getRotation() + deltaRotation);
+				tc.setScale(scale);
 			}
 		}
 		ImGui::End();
@@ -200,11 +202,53 @@ namespace MRG
 		ImGui::Begin("Debug");
 		{
 			ImGui::Checkbox("swap color attachment", &test);
+			bool sortedSubmission = Renderer2D::getQuadSubmissionMode() == QuadSubmissionMode::Deferred;
+			if (ImGui::Checkbox("Sorted quad submission", &sortedSubmission)) {
+				Renderer2D::setQuadSubmissionMode(sortedSubmission ? QuadSubmissionMode::Deferred : QuadSubmissionMode::Immediate);
+			}
+			auto presentationPolicy = Renderer2D::getPresentationPolicy();
+			bool policyChanged = false;
+			if (ImGui::BeginCombo("Present mode", getPresentModeName(presentationPolicy.presentMode))) {
+				for (const auto mode : {PresentMode::FIFO, PresentMode::FIFORelaxed, PresentMode::Mailbox, PresentMode::Immediate}) {
+					if (ImGui::Selectable(getPresentModeName(mode), mode == presentationPolicy.presentMode)) {
+						presentationPolicy.presentMode = mode;
+						policyChanged = true;
+					}
+				}
+				ImGui::EndCombo();
+			}
+			auto framesInFlight = static_cast<int>(presentationPolicy.framesInFlight);
+			if (ImGui::SliderInt("Frames in flight", &framesInFlight, 1, static_cast<int>(PresentationPolicy::maxFramesInFlight))) {
+				presentationPolicy.framesInFlight = static_cast<uint32_t>(framesInFlight);
+				policyChanged = true;
+			}
+			auto imageCount = static_cast<int>(presentationPolicy.swapChainImageCount);
+			if (ImGui::InputInt("Swap chain images (0 for default)", &imageCount)) {
+				presentationPolicy.swapChainImageCount = static_cast<uint32_t>(std::max(imageCount, 0));
+				policyChanged = true;
+			}
+			if (policyChanged) {
+				Renderer2D::setPresentationPolicy(presentationPolicy);
+			}
+			auto frameRateLimit = static_cast<int>(Application::get().getFrameRateLimit());
+			if (ImGui::InputInt("Frame rate limit (0 for none)", &frameRateLimit)) {
+				Application::get().setFrameRateLimit(static_cast<uint32_t>(std::max(frameRateLimit, 0)));
+			}
 			ImGui::Text("Renderer2D stats:");
 			ImGui::Text("Draw calls: %d", stats.drawCalls);
 			ImGui::Text("Quads: %d", stats.quadCount);
+			ImGui::Text("Culled quads: %d", stats.culledQuadCount);
 			ImGui::Text("Vertices: %d", stats.getVertexCount());
 			ImGui::Text("Indices: %d", stats.getIndexCount());
+			ImGui::Text("GPU time: %04.4f ms", stats.getGPUFrameTime());
+			ImGui::Text("  Clearing pass: %04.4f ms", stats.getGPUPassTime(GPUPass::Clearing));
+			ImGui::Text("  Scene pass: %04.4f ms", stats.getGPUPassTime(GPUPass::Scene));
+			ImGui::Text("  ImGui pass: %04.4f ms", stats.getGPUPassTime(GPUPass::ImGui));
+			ImGui::Text("GPU memory: %.2f / %.2f MiB",
+			            static_cast<double>(stats.gpuMemoryUsed) / (1024.0 * 1024.0),
+			            static_cast<double>(stats.gpuMemoryReserved) / (1024.0 * 1024.0));
+			ImGui::Text("  %d allocations in %d blocks", stats.gpuAllocationCount, stats.gpuMemoryBlockCount);
+			ImGui::Text("Input to GPU completion latency: %04.4f ms", stats.inputToGPUCompletionLatency);
 			ImGui::TextColored(tsColor, "Frametime: %04.4f ms (%04.2f FPS)", m_frameTime.getMillieconds(), fps);
 		}
 		ImGui::End();
@@ -272,6 +316,11 @@ namespace MRG
 			}
 		} break;
 
+		// Profiling
+		case Key::F9: {
+			toggleProfiling(shift);
+		} break;
+
 		default: {
 			return false;
 		}
@@ -330,4 +379,23 @@ namespace MRG
 		SceneSerializer serializer{m_activeScene};
 		serializer.serialize(filepath.value());
 	}
+
+	void MachaLayer::toggleProfiling([[maybe_unused]] bool captureFrames)
+	{
+		if (Instrumentor::isSessionActive()) {
+			MRG_PROFILE_END_SESSION()
+			MRG_INFO("Profiling session ended")
+			return;
+		}
+
+		[[maybe_unused]] const auto filepath = fmt::format("MRGProfile-Macha-{}.json", m_profilingSessionCount++);
+		if (captureFrames) {
+			static constexpr uint32_t capturedFrames = 120;
+			MRG_PROFILE_CAPTURE_FRAMES("Macha", filepath, capturedFrames)
+			MRG_INFO("Capturing the next {} frames to '{}'", capturedFrames, filepath)
+		} else {
+			MRG_PROFILE_BEGIN_SESSION("Macha", filepath)
+			MRG_INFO("Profiling to '{}' until F9 is pressed again", filepath)
+		}
+	}
 }  // namespace MRG
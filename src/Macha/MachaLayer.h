@@ -31,6 +31,9 @@ namespace MRG
 		void openScene();
 		void saveScene();
 
+		// Starts a profiling session (limited to a few frames if captureFrames is set), or ends the current one
+		void toggleProfiling(bool captureFrames);
+
 		Ref<Framebuffer> m_renderTarget;
 
 		bool m_viewportFocused = false, m_viewportHovered = false;
@@ -42,6 +45,7 @@ namespace MRG
 		int m_gizmoType = -1;
 
 		Timestep m_frameTime;
+		uint32_t m_profilingSessionCount = 0;
 
 		EditorCamera m_editorCamera;
 
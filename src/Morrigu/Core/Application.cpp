@@ -4,6 +4,7 @@
 #include "Renderer/Renderer2D.h"
 
 #include <functional>
+#include <thread>
 
 namespace MRG
 {
@@ -68,34 +69,87 @@ namespace MRG
 	{
 		MRG_PROFILE_FUNCTION()
 
+		// Long enough not to wake up for nothing, short enough to notice a window shown again without any event
+		static constexpr double occludedWaitTimeout = 0.25;
+
 		while (m_running) {
-			MRG_PROFILE_SCOPE("RunLoop")
+			if (m_minimized || m_window->isOccluded()) {
+				MRG_PROFILE_SCOPE("Occluded")
+
+				// Nothing rendered would be seen, so only the events that may bring the window back are waited for
+				m_window->waitEvents(occludedWaitTimeout);
+				// The time spent hidden doesn't count as a frame for the layers
+				m_lastFrameTime = float(glfwGetTime());
+				continue;
+			}
+
+			{
+				MRG_PROFILE_SCOPE("RunLoop")
 
-			auto time = float(glfwGetTime());
-			Timestep ts = time - m_lastFrameTime;
-			m_lastFrameTime = time;
+				waitForNextFrame();
 
-			while (!Renderer2D::beginFrame()) {}
+				auto time = float(glfwGetTime());
+				Timestep ts = time - m_lastFrameTime;
+				m_lastFrameTime = time;
 
-			if (!m_minimized) {
-				MRG_PROFILE_SCOPE("LayerStack onUpdate")
+				// The renderer blocks until it can render, only failing once it had to recreate its swap chain. As the window may
+				// have been minimized in the meantime, the loop starts over instead of retrying right away.
+				if (!Renderer2D::beginFrame()) {
+					continue;
+				}
 
-				for (auto& layer : m_layerStack) { layer->onUpdate(ts); }
-			}
+				{
+					MRG_PROFILE_SCOPE("LayerStack onUpdate")
 
-			m_ImGuiLayer->begin();
-			{
-				MRG_PROFILE_SCOPE("LayerStack onImGuiRender")
+					for (auto& layer : m_layerStack) { layer->onUpdate(ts); }
+				}
 
-				for (auto& layer : m_layerStack) { layer->onImGuiRender(); }
+				m_ImGuiLayer->begin();
+				{
+					MRG_PROFILE_SCOPE("LayerStack onImGuiRender")
+
+					for (auto& layer : m_layerStack) { layer->onImGuiRender(); }
+				}
+				m_ImGuiLayer->end();
+				m_window->onUpdate();
+
+				Renderer2D::endFrame();
 			}
-			m_ImGuiLayer->end();
-			m_window->onUpdate();
 
-			while (!Renderer2D::endFrame()) {}
+			// Outside of the RunLoop scope, so that the last frame of a capture is complete
+			MRG_PROFILE_END_FRAME()
 		}
 	}
 
+	void Application::waitForNextFrame()
+	{
+		MRG_PROFILE_FUNCTION()
+
+		if (m_frameRateLimit == 0) {
+			return;
+		}
+
+		// Roughly the largest amount of time a sleep overshoots by on common schedulers
+		static constexpr std::chrono::microseconds spinDuration{2000};
+
+		const auto frameDuration =
+		  std::chrono::duration_cast<std::chrono::steady_clock::duration>(std::chrono::duration<double>{1.0 / m_frameRateLimit});
+
+		// A late frame starts right away, and the next ones don't rush to make up for it
+		const auto now = std::chrono::steady_clock::now();
+		if (now >= m_nextFrameTime) {
+			m_nextFrameTime = now + frameDuration;
+			return;
+		}
+
+		if (m_nextFrameTime - now > spinDuration) {
+			std::this_thread::sleep_for(m_nextFrameTime - now - spinDuration);
+		}
+		while (std::chrono::steady_clock::now() < m_nextFrameTime) { std::this_thread::yield(); }
+
+		m_nextFrameTime += frameDuration;
+	}
+
 	bool Application::onWindowClose([[maybe_unused]] WindowCloseEvent& event)
 	{
 		m_running = false;
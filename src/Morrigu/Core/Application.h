@@ -6,7 +6,9 @@
 #include "LayerStack.h"
 #include "Window.h"
 
-int main();
+#include <chrono>
+
+int main(int argc, char** argv);
 
 namespace MRG
 {
@@ -29,12 +31,18 @@ namespace MRG
 
 		void close();
 
+		// 0 lets the application render as many frames as the renderer allows
+		void setFrameRateLimit(uint32_t framesPerSecond) { m_frameRateLimit = framesPerSecond; }
+		[[nodiscard]] uint32_t getFrameRateLimit() const { return m_frameRateLimit; }
+
 		[[nodiscard]] Window& getWindow() const { return *m_window; }
 		[[nodiscard]] ImGuiLayer* getImGuiLayer() const { return m_ImGuiLayer; }
 		[[nodiscard]] static Application& get() { return *s_instance; }
 
 	private:
 		void run();
+		// Sleeps until the frame rate limit allows the next frame, only spinning for the end of the wait that sleeping is too coarse for
+		void waitForNextFrame();
 
 		bool onWindowClose(WindowCloseEvent& event);
 		bool onWindowResize(WindowResizeEvent& event);
@@ -45,10 +53,12 @@ namespace MRG
 		bool m_minimized = false;
 		LayerStack m_layerStack;
 		float m_lastFrameTime = 0.0f;
+		uint32_t m_frameRateLimit = 0;
+		std::chrono::steady_clock::time_point m_nextFrameTime;
 
 		static Application* s_instance;
 
-		friend int ::main();
+		friend int ::main(int argc, char** argv);
 	};
 	Application* createApplication();
 }  // namespace MRG
@@ -4,20 +4,48 @@
 #include "Core/Application.h"
 #include "Debug/Instrumentor.h"
 
-int main()
+#include <cstdlib>
+#include <string_view>
+
+int main(int argc, char** argv)
 {
 	MRG::Logger::init();
 	MRG_ENGINE_INFO("Finished engine initialisation.")
 
-	MRG_PROFILE_BEGIN_SESSION("Startup", "MRGProfile-Startup.json")
+	// --profile traces the startup, the whole runtime and the shutdown, while --profile-frames <count> only traces the first frames.
+	// --frame-rate-limit <fps> caps the number of frames rendered per second.
+	bool profile = false;
+	uint32_t profiledFrames = 0;
+	uint32_t frameRateLimit = 0;
+	for (int i = 1; i < argc; ++i) {
+		const std::string_view argument{argv[i]};
+		if (argument == "--profile") {
+			profile = true;
+		} else if (argument == "--profile-frames" && i + 1 < argc) {
+			profiledFrames = static_cast<uint32_t>(std::strtoul(argv[++i], nullptr, 10));
+		} else if (argument == "--frame-rate-limit" && i + 1 < argc) {
+			frameRateLimit = static_cast<uint32_t>(std::strtoul(argv[++i], nullptr, 10));
+		}
+	}
+
+	if (profile) {
+		MRG_PROFILE_BEGIN_SESSION("Startup", "MRGProfile-Startup.json")
+	}
 	auto* app = MRG::createApplication();
+	app->setFrameRateLimit(frameRateLimit);
 	MRG_PROFILE_END_SESSION()
 
-	MRG_PROFILE_BEGIN_SESSION("Runtime", "MRGProfile-Runtime.json")
+	if (profile) {
+		MRG_PROFILE_BEGIN_SESSION("Runtime", "MRGProfile-Runtime.json")
+	} else if (profiledFrames != 0) {
+		MRG_PROFILE_CAPTURE_FRAMES("Runtime", "MRGProfile-Runtime.json", profiledFrames)
+	}
 	app->run();
 	MRG_PROFILE_END_SESSION()
 
-	MRG_PROFILE_BEGIN_SESSION("Shutdown", "MRGProfile-Shutdown.json")
+	if (profile) {
+		MRG_PROFILE_BEGIN_SESSION("Shutdown", "MRGProfile-Shutdown.json")
+	}
 	delete app;
 	MRG_PROFILE_END_SESSION()
 }
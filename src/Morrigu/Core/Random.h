@@ -0,0 +1,30 @@
+#ifndef MRG_CLASS_RANDOM
+#define MRG_CLASS_RANDOM
+
+#include <cstdint>
+#include <random>
+
+namespace MRG
+{
+	// The output of std distributions is implementation defined, while the one of the engines is fully specified. Only the raw
+	// output of the engine is used here, so that a given seed produces the same sequence with every standard library.
+	class Random
+	{
+	public:
+		explicit Random(uint32_t seed) : m_engine(seed) {}
+
+		[[nodiscard]] uint32_t nextUint() { return static_cast<uint32_t>(m_engine()); }
+		// In [0, bound), the modulo bias is negligible for the bounds this is used with
+		[[nodiscard]] uint32_t nextUint(uint32_t bound) { return nextUint() % bound; }
+
+		// In [0, 1)
+		[[nodiscard]] float nextFloat() { return static_cast<float>(nextUint() >> 8) / 16777216.f; }
+		// In [min, max)
+		[[nodiscard]] float nextFloat(float min, float max) { return min + (max - min) * nextFloat(); }
+
+	private:
+		std::mt19937 m_engine;
+	};
+}  // namespace MRG
+
+#endif
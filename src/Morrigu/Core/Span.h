@@ -0,0 +1,40 @@
+#ifndef MRG_CLASS_SPAN
+#define MRG_CLASS_SPAN
+
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+namespace MRG
+{
+	// Non owning view over contiguous elements (a subset of C++20's std::span)
+	template<typename T>
+	class Span
+	{
+	public:
+		Span() = default;
+		Span(T* data, std::size_t size) : m_data(data), m_size(size) {}
+		// Any contiguous container (std::vector, std::array, another span...) whose elements are convertible
+		template<typename Container,
+		         typename = std::enable_if_t<std::is_convertible_v<decltype(std::declval<Container&>().data()), T*>>>
+		Span(Container& container) : m_data(container.data()), m_size(container.size())  // NOLINT (explicit)
+		{}
+
+		[[nodiscard]] T* data() const { return m_data; }
+		[[nodiscard]] std::size_t size() const { return m_size; }
+		[[nodiscard]] bool empty() const { return m_size == 0; }
+
+		[[nodiscard]] T* begin() const { return m_data; }
+		[[nodiscard]] T* end() const { return m_data + m_size; }
+
+		T& operator[](std::size_t index) const { return m_data[index]; }
+
+		[[nodiscard]] Span subspan(std::size_t offset, std::size_t count) const { return {m_data + offset, count}; }
+
+	private:
+		T* m_data = nullptr;
+		std::size_t m_size = 0;
+	};
+}  // namespace MRG
+
+#endif
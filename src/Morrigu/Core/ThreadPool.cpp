@@ -0,0 +1,77 @@
+#include "ThreadPool.h"
+
+#include <utility>
+
+namespace MRG
+{
+	ThreadPool::ThreadPool(std::size_t workerCount)
+	{
+		m_workers.reserve(workerCount);
+		for (std::size_t i = 0; i < workerCount; ++i) { m_workers.emplace_back(&ThreadPool::workerLoop, this, i); }
+	}
+
+	ThreadPool::~ThreadPool()
+	{
+		{
+			std::lock_guard<std::mutex> lock{m_mutex};
+			m_shouldStop = true;
+		}
+		m_jobsAvailable.notify_all();
+
+		for (auto& worker : m_workers) { worker.join(); }
+	}
+
+	void ThreadPool::parallelFor(std::size_t jobCount, const Job& job)
+	{
+		std::unique_lock<std::mutex> lock{m_mutex};
+		m_job = &job;
+		m_jobCount = jobCount;
+		m_nextJob = 0;
+		m_pendingJobs = jobCount;
+		m_jobsAvailable.notify_all();
+
+		while (m_nextJob < m_jobCount) { runJob(lock, m_workers.size()); }
+
+		m_jobsDone.wait(lock, [this]() { return m_pendingJobs == 0; });
+		m_job = nullptr;
+
+		if (m_exception != nullptr) {
+			std::rethrow_exception(std::exchange(m_exception, nullptr));
+		}
+	}
+
+	void ThreadPool::workerLoop(std::size_t workerIndex)
+	{
+		std::unique_lock<std::mutex> lock{m_mutex};
+		while (true) {
+			m_jobsAvailable.wait(lock, [this]() { return m_shouldStop || (m_job != nullptr && m_nextJob < m_jobCount); });
+			if (m_shouldStop) {
+				return;
+			}
+
+			runJob(lock, workerIndex);
+		}
+	}
+
+	void ThreadPool::runJob(std::unique_lock<std::mutex>& lock, std::size_t workerIndex)
+	{
+		const auto jobIndex = m_nextJob++;
+		const auto& job = *m_job;
+
+		lock.unlock();
+		std::exception_ptr exception;
+		try {
+			job(jobIndex, workerIndex);
+		} catch (...) {
+			exception = std::current_exception();
+		}
+		lock.lock();
+
+		if (exception != nullptr && m_exception == nullptr) {
+			m_exception = exception;
+		}
+		if (--m_pendingJobs == 0) {
+			m_jobsDone.notify_one();
+		}
+	}
+}  // namespace MRG
@@ -0,0 +1,53 @@
+#ifndef MRG_CLASS_THREADPOOL
+#define MRG_CLASS_THREADPOOL
+
+#include <condition_variable>
+#include <cstddef>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace MRG
+{
+	// Fixed set of worker threads, kept alive between parallelFor calls to avoid paying for thread creation every frame
+	class ThreadPool
+	{
+	public:
+		using Job = std::function<void(std::size_t jobIndex, std::size_t workerIndex)>;
+
+		explicit ThreadPool(std::size_t workerCount);
+		ThreadPool(const ThreadPool&) = delete;
+		ThreadPool(ThreadPool&&) = delete;
+		~ThreadPool();
+
+		ThreadPool& operator=(const ThreadPool&) = delete;
+		ThreadPool& operator=(ThreadPool&&) = delete;
+
+		// The thread calling parallelFor counts as a worker, as it runs jobs too instead of just waiting for them
+		[[nodiscard]] std::size_t getWorkerCount() const { return m_workers.size() + 1; }
+
+		// Runs job for every index in [0, jobCount) and only returns once all of them are done.
+		// Jobs running at the same time are guaranteed to have different worker indices, in [0, getWorkerCount()).
+		// If jobs throw, the first exception is rethrown here once every job is done.
+		void parallelFor(std::size_t jobCount, const Job& job);
+
+	private:
+		void workerLoop(std::size_t workerIndex);
+		void runJob(std::unique_lock<std::mutex>& lock, std::size_t workerIndex);
+
+		std::vector<std::thread> m_workers;
+		std::mutex m_mutex;
+		std::condition_variable m_jobsAvailable;
+		std::condition_variable m_jobsDone;
+		const Job* m_job = nullptr;
+		std::size_t m_jobCount = 0;
+		std::size_t m_nextJob = 0;
+		std::size_t m_pendingJobs = 0;
+		std::exception_ptr m_exception;
+		bool m_shouldStop = false;
+	};
+}  // namespace MRG
+
+#endif
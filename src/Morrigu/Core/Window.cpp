@@ -33,7 +33,7 @@ namespace MRG
 				glfwWindowHint(GLFW_OPENGL_DEBUG_CONTEXT, GLFW_TRUE);
 			}
 #endif
-			if (RenderingAPI::getAPI() == RenderingAPI::API::Vulkan) {
+			if (RenderingAPI::getAPI() != RenderingAPI::API::OpenGL) {
 				glfwWindowHint(GLFW_CLIENT_API, GLFW_NO_API);
 			}
 
@@ -163,6 +163,19 @@ namespace MRG
 		m_context->swapBuffers();
 	}
 
+	void Window::waitEvents(double timeout)
+	{
+		MRG_PROFILE_FUNCTION()
+
+		glfwWaitEventsTimeout(timeout);
+	}
+
+	bool Window::isOccluded() const
+	{
+		return glfwGetWindowAttrib(m_window.handle, GLFW_ICONIFIED) == GLFW_TRUE ||
+		       glfwGetWindowAttrib(m_window.handle, GLFW_VISIBLE) == GLFW_FALSE;
+	}
+
 	void Window::setVsync(bool enabled)
 	{
 		MRG_PROFILE_FUNCTION()
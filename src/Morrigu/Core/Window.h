@@ -34,10 +34,14 @@ namespace MRG
 		explicit Window(Scope<WindowProperties> props);
 
 		void onUpdate();
+		// Blocks until an event is received or the timeout (in seconds) expires, then processes the events like onUpdate
+		void waitEvents(double timeout);
 
 		[[nodiscard]] uint32_t getWidth() const { return m_properties->width; }
 		[[nodiscard]] uint32_t getHeight() const { return m_properties->height; }
 		[[nodiscard]] bool isVsync() const { return m_properties->VSync; }
+		// GLFW can't tell whether other windows cover this one, so only hidden and iconified windows count as occluded
+		[[nodiscard]] bool isOccluded() const;
 
 		void setEventCallback(const EventCallbackFunction& callback) { m_properties->callback = callback; }
 		void setVsync(bool enabled);
@@ -0,0 +1,187 @@
+#include "Instrumentor.h"
+
+#include <fmt/format.h>
+
+#include <algorithm>
+#include <iterator>
+
+namespace
+{
+	// The writer wakes up at this interval, which must be short enough for the buffers not to fill up in between
+	constexpr auto writerInterval = std::chrono::milliseconds(10);
+
+	[[nodiscard]] int64_t getCurrentTime()
+	{
+		return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+	}
+}  // namespace
+
+namespace MRG
+{
+	void Instrumentor::beginSession(const std::string& name, const std::string& filepath)
+	{
+		std::lock_guard lock(m_mutex);
+		if (m_currentSession != nullptr) {
+			if (Logger::getEngineLogger()) {
+				MRG_ENGINE_ERROR(
+				  "Instrumentor::beginSession('{}') called when session '{}' was already active!", name, m_currentSession->name)
+			}
+			internalEndSession();
+		}
+		m_outputStream.open(filepath);
+
+		if (m_outputStream.is_open()) {
+			writePrologue();
+			// Events of scopes that were still running when the previous session ended
+			discardEvents();
+
+			m_currentSession = createScope<InstrumentationSession>(InstrumentationSession{name});
+			m_sessionStart = getCurrentTime();
+			m_stopWriter = false;
+			m_writerThread = std::thread{&Instrumentor::writerLoop, this};
+			s_sessionActive.store(true, std::memory_order_relaxed);
+		} else {
+			if (Logger::getEngineLogger()) {
+				MRG_ENGINE_ERROR("Instrumentor could not open file '{}'", filepath)
+			}
+		}
+	}
+
+	void Instrumentor::captureFrames(const std::string& name, const std::string& filepath, uint32_t frameCount)
+	{
+		beginSession(name, filepath);
+
+		std::lock_guard lock(m_mutex);
+		if (m_currentSession != nullptr) {
+			m_remainingFrames = frameCount;
+		}
+	}
+
+	void Instrumentor::endSession()
+	{
+		std::lock_guard lock(m_mutex);
+		internalEndSession();
+	}
+
+	void Instrumentor::countCapturedFrame()
+	{
+		std::lock_guard lock(m_mutex);
+		if (m_remainingFrames != 0 && --m_remainingFrames == 0) {
+			internalEndSession();
+		}
+	}
+
+	ProfileEventBuffer* Instrumentor::registerThread()
+	{
+		std::lock_guard lock(m_buffersMutex);
+		return m_buffers.emplace_back(createScope<ProfileEventBuffer>(static_cast<uint32_t>(m_buffers.size()))).get();
+	}
+
+	void Instrumentor::writePrologue()
+	{
+		m_outputStream << R"({"otherData": {},"traceEvents":[{})";
+		m_outputStream.flush();
+	}
+
+	void Instrumentor::writeEpilogue()
+	{
+		m_outputStream << "]}";
+		m_outputStream.flush();
+	}
+
+	void Instrumentor::writerLoop()
+	{
+		std::unique_lock lock(m_writerMutex);
+		while (!m_stopWriter) {
+			m_writerCondition.wait_for(lock, writerInterval, [this]() { return m_stopWriter; });
+
+			lock.unlock();
+			writeEvents();
+			lock.lock();
+		}
+	}
+
+	void Instrumentor::writeEvents()
+	{
+		{
+			std::lock_guard lock(m_buffersMutex);
+			m_drainedBuffers.clear();
+			for (const auto& buffer : m_buffers) { m_drainedBuffers.push_back(buffer.get()); }
+		}
+
+		m_writeBuffer.clear();
+		for (auto* buffer : m_drainedBuffers) {
+			buffer->drain([this, buffer](const ProfileEvent& event) {
+				if (event.type == ProfileEventType::GPUTime) {
+					fmt::format_to(std::back_inserter(m_writeBuffer),
+					               R"(,{{"args":{{"ms":{:.3f}}},"cat":"gpu","name":"{}","ph":"C","pid":0,"ts":{:.3f}}})",
+					               static_cast<double>(event.duration) / 1000000.0,
+					               getEscapedName(event.name),
+					               static_cast<double>(event.start - m_sessionStart) / 1000.0);
+					return;
+				}
+
+				fmt::format_to(std::back_inserter(m_writeBuffer),
+				               R"(,{{"cat":"function","dur":{:.3f},"name":"{}","ph":"X","pid":0,"tid":{},"ts":{:.3f}}})",
+				               static_cast<double>(event.duration) / 1000.0,
+				               getEscapedName(event.name),
+				               buffer->getThreadIndex(),
+				               static_cast<double>(event.start - m_sessionStart) / 1000.0);
+			});
+			m_droppedCount += buffer->takeDroppedCount();
+		}
+
+		if (!m_writeBuffer.empty()) {
+			m_outputStream.write(m_writeBuffer.data(), static_cast<std::streamsize>(m_writeBuffer.size()));
+		}
+	}
+
+	void Instrumentor::discardEvents()
+	{
+		std::lock_guard lock(m_buffersMutex);
+		for (const auto& buffer : m_buffers) {
+			buffer->drain([](const ProfileEvent&) {});
+			[[maybe_unused]] const auto dropped = buffer->takeDroppedCount();
+		}
+		m_droppedCount = 0;
+	}
+
+	const std::string& Instrumentor::getEscapedName(const char* name)
+	{
+		auto it = m_escapedNames.find(name);
+		if (it == m_escapedNames.end()) {
+			// escaping names to be JSON compliant
+			std::string escapedName{name};
+			std::replace(escapedName.begin(), escapedName.end(), '"', '\'');
+			std::replace(escapedName.begin(), escapedName.end(), '\\', '/');
+			it = m_escapedNames.emplace(name, std::move(escapedName)).first;
+		}
+
+		return it->second;
+	}
+
+	void Instrumentor::internalEndSession()
+	{
+		if (m_currentSession == nullptr) {
+			return;
+		}
+
+		s_sessionActive.store(false, std::memory_order_relaxed);
+		m_remainingFrames = 0;
+		{
+			std::lock_guard lock(m_writerMutex);
+			m_stopWriter = true;
+		}
+		m_writerCondition.notify_one();
+		m_writerThread.join();
+
+		writeEvents();
+		if (m_droppedCount != 0 && Logger::getEngineLogger()) {
+			MRG_ENGINE_WARN("Instrumentor dropped {} events of session '{}' (buffers full)", m_droppedCount, m_currentSession->name)
+		}
+
+		writeEpilogue();
+		m_outputStream.close();
+		m_currentSession = nullptr;
+	}
+}  // namespace MRG
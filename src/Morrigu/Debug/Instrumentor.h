@@ -2,31 +2,82 @@
 #define MRG_INSTRUMENTOR
 
 #include "Core/Core.h"
-#include "Core/Logger.h"
 
-#include <fmt/core.h>
-#include <fmt/ostream.h>
-
-#include <algorithm>
+#include <array>
+#include <atomic>
 #include <chrono>
+#include <condition_variable>
 #include <fstream>
-#include <iomanip>
 #include <mutex>
-#include <sstream>
 #include <string>
 #include <thread>
+#include <unordered_map>
+#include <vector>
 
 namespace MRG
 {
-	using FloatMs = std::chrono::duration<double, std::micro>;
+	enum class ProfileEventType : uint8_t
+	{
+		Scope = 0,
+		// Time spent by the GPU on some work, written as a counter at the time it was read back
+		GPUTime
+	};
 
-	struct ProfileResult
+	// Only the address of the name is recorded, so it must have a static storage duration (string literals, MRG_FUNCSIG...)
+	struct ProfileEvent
 	{
-		std::string name;
+		const char* name;
+		int64_t start;     // Nanoseconds since the epoch of the steady clock
+		int64_t duration;  // Nanoseconds
+		ProfileEventType type = ProfileEventType::Scope;
+	};
+
+	// Single producer (the thread recording its scopes), single consumer (the writer) ring buffer.
+	// Events recorded while it is full are dropped and counted rather than blocking the recording thread.
+	class ProfileEventBuffer
+	{
+	public:
+		static constexpr std::size_t capacity = 1 << 15;
+
+		explicit ProfileEventBuffer(uint32_t threadIndex) : m_threadIndex(threadIndex) {}
+
+		void push(const ProfileEvent& event)
+		{
+			const auto head = m_head.load(std::memory_order_relaxed);
+			if (head - m_cachedTail == capacity) {
+				m_cachedTail = m_tail.load(std::memory_order_acquire);
+				if (head - m_cachedTail == capacity) {
+					m_droppedCount.fetch_add(1, std::memory_order_relaxed);
+					return;
+				}
+			}
+
+			m_events[head % capacity] = event;
+			m_head.store(head + 1, std::memory_order_release);
+		}
+
+		template<typename Consumer>
+		void drain(Consumer&& consumer)
+		{
+			const auto tail = m_tail.load(std::memory_order_relaxed);
+			const auto head = m_head.load(std::memory_order_acquire);
+			for (auto i = tail; i != head; ++i) { consumer(m_events[i % capacity]); }
+			m_tail.store(head, std::memory_order_release);
+		}
+
+		[[nodiscard]] uint32_t getThreadIndex() const { return m_threadIndex; }
+		[[nodiscard]] uint64_t takeDroppedCount() { return m_droppedCount.exchange(0, std::memory_order_relaxed); }
+
+	private:
+		// The producer and consumer indices are on each side of the events to avoid false sharing
+		std::atomic<uint64_t> m_head{0};
+		uint64_t m_cachedTail = 0;
+		std::atomic<uint64_t> m_droppedCount{0};
+		uint32_t m_threadIndex;
 
-		FloatMs start;
-		std::chrono::microseconds elapsedTime;
-		std::thread::id tid;
+		std::array<ProfileEvent, capacity> m_events{};
+
+		std::atomic<uint64_t> m_tail{0};
 	};
 
 	// will be expanded in the future (hopefully)
@@ -37,6 +88,7 @@ namespace MRG
 
 	// this is using the chrome tracing format. More info here for example:
 	// https://www.gamasutra.com/view/news/176420/Indepth_Using_Chrometracing_to_view_your_inline_profiling_data.php
+	// Each thread records its events in its own buffer without any lock, and a writer thread converts them to JSON in the background.
 	class Instrumentor
 	{
 	public:
@@ -46,57 +98,36 @@ namespace MRG
 		Instrumentor& operator=(const Instrumentor&) = delete;
 		Instrumentor& operator=(Instrumentor&&) = delete;
 
-		void beginSession(const std::string& name, const std::string& filepath)
+		void beginSession(const std::string& name, const std::string& filepath);
+		// Begins a session which ends by itself after frameCount frames
+		void captureFrames(const std::string& name, const std::string& filepath, uint32_t frameCount);
+		void endSession();
+
+		// Must be called once at the end of every frame for the frame captures to end
+		void onFrameEnd()
 		{
-			std::lock_guard lock(m_mutex);
-			if (m_currentSession != nullptr) {
-				if (Logger::getEngineLogger()) {
-					MRG_ENGINE_ERROR(
-					  "Instrumentor::beginSession('{}') called when session '{}' was already active!", name, m_currentSession->name)
-				}
-				internalEndSession();
-			}
-			m_outputStream.open(filepath);
-
-			if (m_outputStream.is_open()) {
-				writePrologue();
-				m_currentSession = new InstrumentationSession{name};
-			} else {
-				if (Logger::getEngineLogger()) {
-					MRG_ENGINE_ERROR("Instrumentor could not open file '{}'", filepath)
-				}
+			if (isSessionActive()) {
+				countCapturedFrame();
 			}
 		}
 
-		void endSession()
+		// This is the only thing checked by the profiling macros while no session is active
+		[[nodiscard]] static bool isSessionActive() { return s_sessionActive.load(std::memory_order_relaxed); }
+
+		void record(const ProfileEvent& event)
 		{
-			std::lock_guard lock(m_mutex);
-			internalEndSession();
+			if (s_threadBuffer == nullptr) {
+				s_threadBuffer = registerThread();
+			}
+			s_threadBuffer->push(event);
 		}
 
-		void writeProfile(const ProfileResult& result)
+		// GPU timings are only known a few frames after the work was submitted, so they are recorded when they are read back
+		static void recordGPUTime(const char* name, int64_t duration)
 		{
-			std::stringstream json;
-
-			// escaping names to be JSON compliant
-			std::string name = result.name;
-			std::replace(name.begin(), name.end(), '"', '\'');
-
-			json << std::setprecision(3) << std::fixed;
-			json << ",{";
-			json << R"("cat":"function",)";
-			json << R"("dur":)" << result.elapsedTime.count() << ",";
-			json << fmt::format(R"("name":"{}",)", name);
-			json << R"("ph":"X",)";
-			json << R"("pid":0,)";
-			json << fmt::format(R"("tid":{},)", result.tid);
-			json << R"("ts":)" << result.start.count();
-			json << '}';
-
-			std::lock_guard lock(m_mutex);
-			if (m_currentSession != nullptr) {
-				m_outputStream << json.str();
-				m_outputStream.flush();
+			if (isSessionActive()) {
+				const auto now = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch());
+				get().record({name, now.count(), duration, ProfileEventType::GPUTime});
 			}
 		}
 
@@ -110,31 +141,42 @@ namespace MRG
 		Instrumentor() = default;
 		~Instrumentor() { endSession(); }
 
-		void writePrologue()
-		{
-			m_outputStream << R"({"otherData": {},"traceEvents":[{})";
-			m_outputStream.flush();
-		}
+		ProfileEventBuffer* registerThread();
+		void countCapturedFrame();
 
-		void writeEpilogue()
-		{
-			m_outputStream << "]}";
-			m_outputStream.flush();
-		}
+		void writePrologue();
+		void writeEpilogue();
+		void writerLoop();
+		// Must only be called by the writer thread, or while it is not running
+		void writeEvents();
+		void discardEvents();
+		[[nodiscard]] const std::string& getEscapedName(const char* name);
 
-		void internalEndSession()
-		{
-			if (m_currentSession != nullptr) {
-				writeEpilogue();
-				m_outputStream.close();
-				delete m_currentSession;
-				m_currentSession = nullptr;
-			}
-		}
+		void internalEndSession();
+
+		// Buffers are never freed before the instrumentor, as the events of a thread may be written after it exited
+		inline static thread_local ProfileEventBuffer* s_threadBuffer = nullptr;
+		std::mutex m_buffersMutex;
+		std::vector<Scope<ProfileEventBuffer>> m_buffers;
 
 		std::mutex m_mutex;
-		InstrumentationSession* m_currentSession = nullptr;
+		Scope<InstrumentationSession> m_currentSession;
+		inline static std::atomic<bool> s_sessionActive{false};
+		int64_t m_sessionStart = 0;
+		// 0 when the session is not a frame capture
+		uint32_t m_remainingFrames = 0;
 		std::ofstream m_outputStream;
+
+		std::thread m_writerThread;
+		std::mutex m_writerMutex;
+		std::condition_variable m_writerCondition;
+		bool m_stopWriter = false;
+
+		// Only used by the writer
+		std::vector<ProfileEventBuffer*> m_drainedBuffers;
+		std::unordered_map<const char*, std::string> m_escapedNames;
+		std::string m_writeBuffer;
+		uint64_t m_droppedCount = 0;
 	};
 
 	class InstrumentationTimer
@@ -146,9 +188,11 @@ namespace MRG
 		InstrumentationTimer& operator=(const InstrumentationTimer&) = delete;
 		InstrumentationTimer& operator=(InstrumentationTimer&&) = delete;
 
-		explicit InstrumentationTimer(const char* name) : m_name(name), m_stopped(false)
+		explicit InstrumentationTimer(const char* name) : m_name(name), m_stopped(!Instrumentor::isSessionActive())
 		{
-			m_startTimePoint = std::chrono::steady_clock::now();
+			if (!m_stopped) {
+				m_startTimePoint = std::chrono::steady_clock::now();
+			}
 		}
 
 		~InstrumentationTimer()
@@ -160,13 +204,11 @@ namespace MRG
 
 		void stop()
 		{
-			auto endTimePoint = std::chrono::steady_clock::now();
+			const auto endTimePoint = std::chrono::steady_clock::now();
 
-			auto start = FloatMs{m_startTimePoint.time_since_epoch()};
-			auto elapsed = std::chrono::time_point_cast<std::chrono::microseconds>(endTimePoint).time_since_epoch() -
-			               std::chrono::time_point_cast<std::chrono::microseconds>(m_startTimePoint).time_since_epoch();
-
-			Instrumentor::get().writeProfile({m_name, start, elapsed, std::this_thread::get_id()});
+			const auto start = std::chrono::duration_cast<std::chrono::nanoseconds>(m_startTimePoint.time_since_epoch());
+			const auto duration = std::chrono::duration_cast<std::chrono::nanoseconds>(endTimePoint - m_startTimePoint);
+			Instrumentor::get().record({m_name, start.count(), duration.count()});
 
 			m_stopped = true;
 		}
@@ -178,18 +220,28 @@ namespace MRG
 	};
 }  // namespace MRG
 
+// Profiling is compiled in by default, and only costs the check of a flag while no session is running, so that traces can be captured
+// from the binaries that are shipped. Define MRG_PROFILING to 0 to strip it entirely.
 // clang-format off
-#define MRG_PROFILING 0
+#ifndef MRG_PROFILING
+	#define MRG_PROFILING 1
+#endif
 #if MRG_PROFILING
 	#define MRG_PROFILE_BEGIN_SESSION(name, filepath) ::MRG::Instrumentor::get().beginSession(name, filepath);
+	#define MRG_PROFILE_CAPTURE_FRAMES(name, filepath, frameCount) ::MRG::Instrumentor::get().captureFrames(name, filepath, frameCount);
 	#define MRG_PROFILE_END_SESSION() ::MRG::Instrumentor::get().endSession();
+	#define MRG_PROFILE_END_FRAME() ::MRG::Instrumentor::get().onFrameEnd();
 	#define MRG_PROFILE_SCOPE(name) ::MRG::InstrumentationTimer MRG_PREPOC_EVALUATOR(timer,__LINE__)(name); // we need this workaround to uniquely define timers
 	#define MRG_PROFILE_FUNCTION() MRG_PROFILE_SCOPE(MRG_FUNCSIG);
+	#define MRG_PROFILE_GPU_TIME(name, duration) ::MRG::Instrumentor::recordGPUTime(name, duration);
 #else
 	#define MRG_PROFILE_BEGIN_SESSION(name, filepath)
+	#define MRG_PROFILE_CAPTURE_FRAMES(name, filepath, frameCount)
 	#define MRG_PROFILE_END_SESSION()
+	#define MRG_PROFILE_END_FRAME()
 	#define MRG_PROFILE_SCOPE(name)
 	#define MRG_PROFILE_FUNCTION()
+	#define MRG_PROFILE_GPU_TIME(name, duration)
 #endif
 // clang-format on
 
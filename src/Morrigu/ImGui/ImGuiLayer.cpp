@@ -176,7 +176,9 @@ namespace MRG
 		switch (RenderingAPI::getAPI()) {
 		case RenderingAPI::API::OpenGL: {
 			ImGui::Render();
+			Renderer2D::beginGPUPass(GPUPass::ImGui);
 			ImGui_ImplOpenGL3_RenderDrawData(ImGui::GetDrawData());
+			Renderer2D::endGPUPass();
 
 			if ((io.ConfigFlags & ImGuiConfigFlags_ViewportsEnable) != 0) {
 				const auto contextBkp = glfwGetCurrentContext();
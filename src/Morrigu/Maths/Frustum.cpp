@@ -0,0 +1,113 @@
+#include "Frustum.h"
+
+#include "Debug/Instrumentor.h"
+
+#if defined(__SSE2__) || defined(_M_X64)
+#define MRG_FRUSTUM_SSE
+#include <emmintrin.h>
+#endif
+
+namespace
+{
+	[[nodiscard]] bool isBoxVisible(const MRG::Maths::Frustum& frustum, const glm::vec3& center, const glm::vec3& extents)
+	{
+		for (const auto& plane : frustum.planes) {
+			const auto normal = glm::vec3{plane};
+			const auto distance = glm::dot(normal, center) + plane.w;
+			const auto radius = glm::dot(glm::abs(normal), extents);
+			if (distance + radius < 0.f) {
+				return false;
+			}
+		}
+
+		return true;
+	}
+}  // namespace
+
+namespace MRG::Maths
+{
+	Frustum::Frustum(const glm::mat4& viewProjection) : planes{}
+	{
+		// Gribb & Hartmann plane extraction, adapted to a [0, 1] depth range
+		const auto row = [&viewProjection](int i) {
+			return glm::vec4{viewProjection[0][i], viewProjection[1][i], viewProjection[2][i], viewProjection[3][i]};
+		};
+
+		planes[0] = row(3) + row(0);
+		planes[1] = row(3) - row(0);
+		planes[2] = row(3) + row(1);
+		planes[3] = row(3) - row(1);
+		planes[4] = row(2);
+		planes[5] = row(3) - row(2);
+
+		for (auto& plane : planes) { plane /= glm::length(glm::vec3{plane}); }
+	}
+
+	void BoxArray::clear()
+	{
+		centerX.clear();
+		centerY.clear();
+		centerZ.clear();
+		extentX.clear();
+		extentY.clear();
+		extentZ.clear();
+	}
+
+	void BoxArray::push(const glm::vec3& center, const glm::vec3& extents)
+	{
+		centerX.push_back(center.x);
+		centerY.push_back(center.y);
+		centerZ.push_back(center.z);
+		extentX.push_back(extents.x);
+		extentY.push_back(extents.y);
+		extentZ.push_back(extents.z);
+	}
+
+	void cullBoxes(const Frustum& frustum, const BoxArray& boxes, std::vector<uint8_t>& visibility)
+	{
+		MRG_PROFILE_FUNCTION()
+
+		const auto count = boxes.size();
+		visibility.resize(count);
+
+		std::size_t i = 0;
+#ifdef MRG_FRUSTUM_SSE
+		// Four boxes are tested against each plane at once
+		const auto signMask = _mm_set1_ps(-0.f);
+		for (; i + 4 <= count; i += 4) {
+			const auto centerX = _mm_loadu_ps(&boxes.centerX[i]);
+			const auto centerY = _mm_loadu_ps(&boxes.centerY[i]);
+			const auto centerZ = _mm_loadu_ps(&boxes.centerZ[i]);
+			const auto extentX = _mm_loadu_ps(&boxes.extentX[i]);
+			const auto extentY = _mm_loadu_ps(&boxes.extentY[i]);
+			const auto extentZ = _mm_loadu_ps(&boxes.extentZ[i]);
+
+			auto outside = _mm_setzero_ps();
+			for (const auto& plane : frustum.planes) {
+				const auto normalX = _mm_set1_ps(plane.x);
+				const auto normalY = _mm_set1_ps(plane.y);
+				const auto normalZ = _mm_set1_ps(plane.z);
+
+				auto distance = _mm_add_ps(_mm_mul_ps(centerX, normalX), _mm_set1_ps(plane.w));
+				distance = _mm_add_ps(distance, _mm_mul_ps(centerY, normalY));
+				distance = _mm_add_ps(distance, _mm_mul_ps(centerZ, normalZ));
+
+				auto radius = _mm_mul_ps(extentX, _mm_andnot_ps(signMask, normalX));
+				radius = _mm_add_ps(radius, _mm_mul_ps(extentY, _mm_andnot_ps(signMask, normalY)));
+				radius = _mm_add_ps(radius, _mm_mul_ps(extentZ, _mm_andnot_ps(signMask, normalZ)));
+
+				outside = _mm_or_ps(outside, _mm_cmplt_ps(_mm_add_ps(distance, radius), _mm_setzero_ps()));
+			}
+
+			const auto outsideMask = _mm_movemask_ps(outside);
+			for (std::size_t lane = 0; lane < 4; ++lane) { visibility[i + lane] = ((outsideMask >> lane) & 1) == 0 ? 1 : 0; }
+		}
+#endif
+
+		for (; i < count; ++i) {
+			const glm::vec3 center{boxes.centerX[i], boxes.centerY[i], boxes.centerZ[i]};
+			const glm::vec3 extents{boxes.extentX[i], boxes.extentY[i], boxes.extentZ[i]};
+			visibility[i] = isBoxVisible(frustum, center, extents) ? 1 : 0;
+		}
+	}
+}  // namespace MRG::Maths
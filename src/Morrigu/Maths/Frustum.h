@@ -0,0 +1,35 @@
+#ifndef MRG_MATHS_FRUSTUM
+#define MRG_MATHS_FRUSTUM
+
+#include "Core/GLMIncludeHelper.h"
+
+#include <array>
+#include <cstdint>
+#include <vector>
+
+namespace MRG::Maths
+{
+	struct Frustum
+	{
+		// Planes are stored as (normal, distance), with normals pointing inside the frustum
+		std::array<glm::vec4, 6> planes;
+
+		explicit Frustum(const glm::mat4& viewProjection);
+	};
+
+	// Axis aligned boxes, stored as a structure of arrays so that several of them can be tested at once
+	struct BoxArray
+	{
+		std::vector<float> centerX, centerY, centerZ;
+		std::vector<float> extentX, extentY, extentZ;
+
+		void clear();
+		void push(const glm::vec3& center, const glm::vec3& extents);
+		[[nodiscard]] std::size_t size() const { return centerX.size(); }
+	};
+
+	// Sets visibility[i] to 1 if the i-th box intersects the frustum, and to 0 otherwise
+	void cullBoxes(const Frustum& frustum, const BoxArray& boxes, std::vector<uint8_t>& visibility);
+}  // namespace MRG::Maths
+
+#endif
@@ -14,6 +14,8 @@
 #include "Renderer/Buffers.h"
 #include "Renderer/Renderer2D.h"
 #include "Renderer/Shader.h"
+#include "Renderer/SubTexture2D.h"
+#include "Renderer/TextureAtlas.h"
 #include "Renderer/Textures.h"
 #include "Renderer/VertexArray.h"
 
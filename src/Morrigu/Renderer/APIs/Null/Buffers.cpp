@@ -0,0 +1,42 @@
+#include "Buffers.h"
+
+#include "Debug/Instrumentor.h"
+
+#include <cstring>
+
+namespace MRG::Null
+{
+	VertexBuffer::VertexBuffer(uint32_t size) : m_data(size) {}
+
+	VertexBuffer::VertexBuffer(const void* vertices, uint32_t size) : m_data(size) { std::memcpy(m_data.data(), vertices, size); }
+
+	void VertexBuffer::destroy()
+	{
+		if (m_isDestroyed) {
+			return;
+		}
+
+		m_data = {};
+		m_isDestroyed = true;
+	}
+
+	void VertexBuffer::setData(const void* data, uint32_t size)
+	{
+		MRG_PROFILE_FUNCTION()
+
+		MRG_CORE_ASSERT(size <= m_data.size(), "Data is too big for the vertex buffer!")
+		std::memcpy(m_data.data(), data, size);
+	}
+
+	IndexBuffer::IndexBuffer(const uint32_t* indices, uint32_t count) : m_indices(indices, indices + count) {}
+
+	void IndexBuffer::destroy()
+	{
+		if (m_isDestroyed) {
+			return;
+		}
+
+		m_indices = {};
+		m_isDestroyed = true;
+	}
+}  // namespace MRG::Null
@@ -0,0 +1,59 @@
+#ifndef MRG_NULL_IMPL_BUFFERS
+#define MRG_NULL_IMPL_BUFFERS
+
+#include "Renderer/Buffers.h"
+
+#include <vector>
+
+namespace MRG::Null
+{
+	// Buffers only live in system memory, so that filling them costs the same as filling a mapped GPU buffer
+	class VertexBuffer : public MRG::VertexBuffer
+	{
+	public:
+		explicit VertexBuffer(uint32_t size);
+		VertexBuffer(const void* vertices, uint32_t size);
+		VertexBuffer(const VertexBuffer&) = delete;
+		VertexBuffer(VertexBuffer&&) = delete;
+		~VertexBuffer() override = default;
+
+		VertexBuffer& operator=(const VertexBuffer&) = delete;
+		VertexBuffer& operator=(VertexBuffer&&) = delete;
+
+		void destroy() override;
+
+		void bind() const override {}
+		void unbind() const override {}
+
+		void setData(const void* data, uint32_t size) override;
+
+		[[nodiscard]] void* getData() { return m_data.data(); }
+
+	private:
+		std::vector<uint8_t> m_data;
+	};
+
+	class IndexBuffer : public MRG::IndexBuffer
+	{
+	public:
+		IndexBuffer(const uint32_t* indices, uint32_t count);
+		IndexBuffer(const IndexBuffer&) = delete;
+		IndexBuffer(IndexBuffer&&) = delete;
+		~IndexBuffer() override = default;
+
+		IndexBuffer& operator=(const IndexBuffer&) = delete;
+		IndexBuffer& operator=(IndexBuffer&&) = delete;
+
+		void destroy() override;
+
+		void bind() const override {}
+		void unbind() const override {}
+
+		[[nodiscard]] uint32_t getCount() const override { return static_cast<uint32_t>(m_indices.size()); };
+
+	private:
+		std::vector<uint32_t> m_indices;
+	};
+}  // namespace MRG::Null
+
+#endif
@@ -0,0 +1,24 @@
+#ifndef MRG_NULL_IMPL_CONTEXT
+#define MRG_NULL_IMPL_CONTEXT
+
+#include "Renderer/Context.h"
+
+namespace MRG::Null
+{
+	class Context : public MRG::Context
+	{
+	public:
+		Context() = default;
+		Context(const Context&) = delete;
+		Context(Context&&) = delete;
+		~Context() override = default;
+
+		Context& operator=(const Context&) = delete;
+		Context& operator=(Context&&) = delete;
+
+		void swapBuffers() override {}
+		void swapInterval(int) override {}
+	};
+}  // namespace MRG::Null
+
+#endif
@@ -0,0 +1,28 @@
+#include "Framebuffer.h"
+
+#include "Debug/Instrumentor.h"
+
+namespace MRG::Null
+{
+	Framebuffer::Framebuffer(const FramebufferSpecification& spec)
+	{
+		MRG_PROFILE_FUNCTION()
+
+		m_specification = spec;
+		for (const auto& attachment : m_specification.attachments.attachments) {
+			if (!isDepthFormat(attachment.textureFormat)) {
+				m_colorAttachmentsSpecifications.emplace_back(attachment);
+			} else {
+				m_depthAttachmentsSpecification = attachment;
+			}
+		}
+	}
+
+	void Framebuffer::resize(uint32_t width, uint32_t height)
+	{
+		MRG_PROFILE_FUNCTION()
+
+		m_specification.width = width;
+		m_specification.height = height;
+	}
+}  // namespace MRG::Null
@@ -0,0 +1,32 @@
+#ifndef MRG_NULL_IMPL_FRAMEBUFFER
+#define MRG_NULL_IMPL_FRAMEBUFFER
+
+#include "Renderer/Framebuffer.h"
+
+namespace MRG::Null
+{
+	class Framebuffer : public MRG::Framebuffer
+	{
+	public:
+		explicit Framebuffer(const FramebufferSpecification& spec);
+		Framebuffer(const Framebuffer&) = delete;
+		Framebuffer(Framebuffer&&) = delete;
+		~Framebuffer() override = default;
+
+		Framebuffer& operator=(const Framebuffer&) = delete;
+		Framebuffer& operator=(Framebuffer&&) = delete;
+
+		void destroy() override { m_isDestroyed = true; }
+		void resize(uint32_t width, uint32_t height) override;
+
+		[[nodiscard]] ImTextureID getImTextureID(uint32_t) override { return nullptr; }
+		[[nodiscard]] const std::array<ImVec2, 2>& getUVMapping() const override { return m_UVMapping; }
+
+		[[nodiscard]] const FramebufferSpecification& getSpecification() const override { return m_specification; }
+
+	private:
+		std::array<ImVec2, 2> m_UVMapping = {ImVec2{0, 0}, ImVec2{1, 1}};
+	};
+}  // namespace MRG::Null
+
+#endif
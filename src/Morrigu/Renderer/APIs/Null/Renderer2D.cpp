@@ -0,0 +1,168 @@
+#include "Renderer2D.h"
+
+#include "Debug/Instrumentor.h"
+
+namespace MRG::Null
+{
+	void Renderer2D::init()
+	{
+		MRG_PROFILE_FUNCTION()
+
+		m_quadVertexArray = VertexArray::create();
+
+		if (m_renderingMode == QuadRenderingMode::Instanced) {
+			m_quadVertexBuffer = VertexBuffer::create(maxQuads * sizeof(QuadInstance));
+			m_quadVertexBuffer->layout = QuadInstance::getLayout();
+			m_quadVertexBuffer->perInstance = true;
+			m_qibBase = new QuadInstance[maxQuads];
+		} else {
+			m_quadVertexBuffer = VertexBuffer::create(maxVertices * sizeof(QuadVertex));
+			m_quadVertexBuffer->layout = QuadVertex::getLayout();
+			m_qvbBase = new QuadVertex[maxVertices];
+		}
+		m_quadVertexArray->addVertexBuffer(m_quadVertexBuffer);
+
+		auto quadIndices = new uint32_t[maxIndices];
+
+		uint32_t offset = 0;
+		for (uint32_t i = 0; i < maxIndices; i += 6) {
+			quadIndices[i + 0] = offset + 0;
+			quadIndices[i + 1] = offset + 1;
+			quadIndices[i + 2] = offset + 2;
+
+			quadIndices[i + 3] = offset + 2;
+			quadIndices[i + 4] = offset + 3;
+			quadIndices[i + 5] = offset + 0;
+
+			offset += 4;
+		}
+
+		Ref<IndexBuffer> quadIB = IndexBuffer::create(quadIndices, maxIndices);
+		m_quadVertexArray->setIndexBuffer(quadIB);
+		delete[] quadIndices;
+
+		m_whiteTexture = Texture2D::create(1, 1);
+		auto whiteTextureData = 0xffffffff;
+		m_whiteTexture->setData(&whiteTextureData, sizeof(whiteTextureData));
+
+		m_textureSlots[0] = m_whiteTexture;
+
+		MRG_ENGINE_INFO("Using the null rendering API, nothing will be displayed.")
+	}
+
+	void Renderer2D::shutdown()
+	{
+		MRG_PROFILE_FUNCTION()
+
+		m_whiteTexture->destroy();
+		m_quadVertexArray->destroy();
+
+		for (const auto& texture : m_textureSlots) {
+			if (texture != nullptr) {
+				texture->destroy();
+			}
+		}
+
+		if (m_framebuffer != nullptr) {
+			m_framebuffer->destroy();
+		}
+
+		delete[] m_qvbBase;
+		delete[] m_qibBase;
+	}
+
+	bool Renderer2D::beginFrame()
+	{
+		MRG_PROFILE_FUNCTION()
+
+		return true;
+	}
+
+	bool Renderer2D::endFrame()
+	{
+		MRG_PROFILE_FUNCTION()
+
+		return true;
+	}
+
+	void Renderer2D::beginScene(const Camera&, const glm::mat4&)
+	{
+		MRG_PROFILE_FUNCTION()
+
+		startBatch();
+		m_sceneInProgress = true;
+	}
+
+	void Renderer2D::beginScene(const EditorCamera&)
+	{
+		MRG_PROFILE_FUNCTION()
+
+		startBatch();
+		m_sceneInProgress = true;
+	}
+
+	void Renderer2D::endScene()
+	{
+		MRG_PROFILE_FUNCTION()
+
+		flush();
+		m_sceneInProgress = false;
+	}
+
+	void Renderer2D::setRenderTarget(Ref<MRG::Framebuffer> renderTarget)
+	{
+		if (renderTarget == nullptr) {
+			resetRenderTarget();
+			return;
+		}
+
+		if (m_sceneInProgress) {
+			flushAndReset();
+		}
+
+		m_framebuffer = std::static_pointer_cast<Framebuffer>(renderTarget);
+	}
+
+	void Renderer2D::resetRenderTarget()
+	{
+		if (m_sceneInProgress) {
+			flushAndReset();
+		}
+
+		m_framebuffer = nullptr;
+	}
+
+	void Renderer2D::startBatch()
+	{
+		m_quadIndexCount = 0;
+		m_qvbPtr = m_qvbBase;
+		m_qibPtr = m_qibBase;
+		m_textureSlotindex = 1;
+	}
+
+	void Renderer2D::flush()
+	{
+		if (m_quadIndexCount == 0) {
+			return;
+		}
+
+		// Still copied to the vertex buffer, to account for the upload the other APIs would do
+		if (m_renderingMode == QuadRenderingMode::Instanced) {
+			auto dataSize = static_cast<uint32_t>((uint8_t*)m_qibPtr - (uint8_t*)m_qibBase);
+			m_quadVertexBuffer->setData(m_qibBase, dataSize);
+		} else {
+			auto dataSize = static_cast<uint32_t>((uint8_t*)m_qvbPtr - (uint8_t*)m_qvbBase);
+			m_quadVertexBuffer->setData(m_qvbBase, dataSize);
+		}
+
+		// This is where the other APIs would bind the textures and issue the draw call
+		++m_stats.drawCalls;
+	}
+
+	void Renderer2D::flushAndReset()
+	{
+		// Unlike endScene, the scene stays in progress: the next render target change still has to flush the batch
+		flush();
+		startBatch();
+	}
+}  // namespace MRG::Null
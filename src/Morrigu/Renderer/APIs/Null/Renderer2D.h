@@ -0,0 +1,54 @@
+#ifndef MRG_NULL_IMPL_RENDERER2D
+#define MRG_NULL_IMPL_RENDERER2D
+
+#include "Renderer/VertexArray.h"
+
+#include "Renderer/APIs/Null/Framebuffer.h"
+#include "Renderer/APIs/Null/Textures.h"
+#include "Renderer/Framebuffer.h"
+#include "Renderer/Renderer2D.h"
+
+namespace MRG::Null
+{
+	// Runs everything the other renderers do on the CPU (vertex generation, batching, texture slots management, statistics), but
+	// never draws anything. Useful to run the engine without a window nor a GPU, for tests and benchmarks.
+	class Renderer2D : public MRG::Generic2DRenderer
+	{
+	public:
+		virtual ~Renderer2D() = default;
+
+		void init() override;
+		void shutdown() override;
+
+		void onWindowResize(uint32_t, uint32_t) override {}
+
+		bool beginFrame() override;
+		bool endFrame() override;
+
+		void beginScene(const Camera& camera, const glm::mat4& transform) override;
+		void beginScene(const EditorCamera& camera) override;
+		void endScene() override;
+
+		void setRenderTarget(Ref<MRG::Framebuffer> renderTarget) override;
+		void resetRenderTarget() override;
+		[[nodiscard]] Ref<MRG::Framebuffer> getRenderTarget() const override { return m_framebuffer; }
+
+		void setViewport(uint32_t, uint32_t, uint32_t, uint32_t) override {}
+		void setClearColor(const glm::vec4&) override {}
+		void clear() override {}
+
+	private:
+		void startBatch();
+		void flush();
+		void flushAndReset() override;
+
+		Ref<MRG::VertexArray> m_quadVertexArray;
+		Ref<MRG::VertexBuffer> m_quadVertexBuffer;
+		Ref<MRG::Texture2D> m_whiteTexture;
+
+		Ref<Framebuffer> m_framebuffer = nullptr;
+		bool m_sceneInProgress = false;
+	};
+}  // namespace MRG::Null
+
+#endif
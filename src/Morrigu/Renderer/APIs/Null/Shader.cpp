@@ -0,0 +1,8 @@
+#include "Shader.h"
+
+#include <filesystem>
+
+namespace MRG::Null
+{
+	Shader::Shader(const std::string& filePath) : m_name(std::filesystem::path{filePath}.stem().string()) {}
+}  // namespace MRG::Null
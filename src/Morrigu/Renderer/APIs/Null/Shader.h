@@ -0,0 +1,39 @@
+#ifndef MRG_NULL_IMPL_SHADER
+#define MRG_NULL_IMPL_SHADER
+
+#include "Renderer/Shader.h"
+
+namespace MRG::Null
+{
+	// Shaders are never read nor compiled, only their name is kept for the ShaderLibrary
+	class Shader : public MRG::Shader
+	{
+	public:
+		explicit Shader(const std::string& filePath);
+		Shader(const Shader&) = delete;
+		Shader(Shader&&) = delete;
+		~Shader() override = default;
+
+		Shader& operator=(const Shader&) = delete;
+		Shader& operator=(Shader&&) = delete;
+
+		void destroy() override { m_isDestroyed = true; }
+
+		void bind() const override {}
+		void unbind() const override {}
+
+		void upload(const std::string&, int) override {}
+		void upload(const std::string&, int*, std::size_t) override {}
+		void upload(const std::string&, float) override {}
+		void upload(const std::string&, const glm::vec3&) override {}
+		void upload(const std::string&, const glm::vec4&) override {}
+		void upload(const std::string&, const glm::mat4&) override {}
+
+		[[nodiscard]] const std::string& getName() const override { return m_name; }
+
+	private:
+		std::string m_name;
+	};
+}  // namespace MRG::Null
+
+#endif
@@ -0,0 +1,50 @@
+#include "Textures.h"
+
+#include "Debug/Instrumentor.h"
+#include "Renderer/ImageLoader.h"
+
+#include <stb_image.h>
+
+#include <atomic>
+
+namespace
+{
+	// Stands in for the GPU handles used to compare textures
+	[[nodiscard]] uint32_t generateTextureID()
+	{
+		static std::atomic<uint32_t> nextID{0};
+		return nextID++;
+	}
+}  // namespace
+
+namespace MRG::Null
+{
+	Texture2D::Texture2D(uint32_t width, uint32_t height) : m_width(width), m_height(height), m_id(generateTextureID())
+	{
+		MRG_PROFILE_FUNCTION()
+	}
+
+	Texture2D::Texture2D(const std::string& path) : m_id(generateTextureID())
+	{
+		MRG_PROFILE_FUNCTION()
+
+		int width, height, channels;
+		stbi_uc* data = nullptr;
+		{
+			MRG_PROFILE_SCOPE("stbi_load - Null::Texture2D::Texture2D(const std::string&)")
+			data = ImageLoader::loadFromFile(path.c_str(), &width, &height, &channels, STBI_rgb_alpha, true);
+		}
+		MRG_CORE_ASSERT(data, fmt::format("Failed to load image '{}'!", path))
+
+		m_width = width;
+		m_height = height;
+		stbi_image_free(data);
+	}
+
+	void Texture2D::setData([[maybe_unused]] void* data, [[maybe_unused]] uint32_t size)
+	{
+		MRG_PROFILE_FUNCTION()
+
+		MRG_CORE_ASSERT(size == m_width * m_height * 4, "Data must be entire texture!")
+	}
+}  // namespace MRG::Null
@@ -0,0 +1,39 @@
+#ifndef MRG_NULL_IMPL_TEXTURES
+#define MRG_NULL_IMPL_TEXTURES
+
+#include "Renderer/Textures.h"
+
+namespace MRG::Null
+{
+	// Only keeps track of its size. Textures loaded from files are still decoded, to keep the loading cost realistic.
+	class Texture2D : public MRG::Texture2D
+	{
+	public:
+		Texture2D(uint32_t width, uint32_t height);
+		explicit Texture2D(const std::string& path);
+		Texture2D(const Texture2D&) = delete;
+		Texture2D(Texture2D&&) = delete;
+		~Texture2D() override = default;
+
+		Texture2D& operator=(const Texture2D&) = delete;
+		Texture2D& operator=(Texture2D&&) = delete;
+
+		bool operator==(const Texture& other) const override { return m_id == ((Null::Texture2D&)other).m_id; }
+
+		void destroy() override { m_isDestroyed = true; }
+
+		[[nodiscard]] uint32_t getWidth() const override { return m_width; };
+		[[nodiscard]] uint32_t getHeight() const override { return m_height; };
+		[[nodiscard]] ImTextureID getImTextureID() override { return nullptr; };
+
+		void setData(void* data, uint32_t size) override;
+
+		void bind(uint32_t) const override {}
+
+	private:
+		uint32_t m_width = 0, m_height = 0;
+		uint32_t m_id;
+	};
+}  // namespace MRG::Null
+
+#endif
@@ -0,0 +1,47 @@
+#ifndef MRG_NULL_IMPL_VERTEXARRAY
+#define MRG_NULL_IMPL_VERTEXARRAY
+
+#include "Renderer/VertexArray.h"
+
+namespace MRG::Null
+{
+	class VertexArray : public MRG::VertexArray
+	{
+	public:
+		VertexArray() = default;
+		VertexArray(const VertexArray&) = delete;
+		VertexArray(VertexArray&&) = delete;
+		~VertexArray() override = default;
+
+		VertexArray& operator=(const VertexArray&) = delete;
+		VertexArray& operator=(VertexArray&&) = delete;
+
+		void destroy() override
+		{
+			if (m_isDestroyed) {
+				return;
+			}
+
+			for (auto& vb : m_vertexBuffers) { vb->destroy(); }
+			if (m_indexBuffer != nullptr) {
+				m_indexBuffer->destroy();
+			}
+			m_isDestroyed = true;
+		}
+
+		void bind() const override {}
+		void unbind() const override {}
+
+		void addVertexBuffer(const Ref<MRG::VertexBuffer>& vertexBuffer) override { m_vertexBuffers.push_back(vertexBuffer); }
+		void setIndexBuffer(const Ref<MRG::IndexBuffer>& indexBuffer) override { m_indexBuffer = indexBuffer; }
+
+		[[nodiscard]] const std::vector<Ref<MRG::VertexBuffer>>& getVertexBuffers() const override { return m_vertexBuffers; };
+		[[nodiscard]] const Ref<MRG::IndexBuffer>& getIndexBuffer() const override { return m_indexBuffer; };
+
+	private:
+		std::vector<Ref<MRG::VertexBuffer>> m_vertexBuffers;
+		Ref<MRG::IndexBuffer> m_indexBuffer;
+	};
+}  // namespace MRG::Null
+
+#endif
@@ -10,11 +10,18 @@ namespace MRG::OpenGL
 
 		m_quadVertexArray = VertexArray::create();
 
-		m_quadVertexBuffer = VertexBuffer::create(maxVertices * sizeof(QuadVertex));
-		m_quadVertexBuffer->layout = QuadVertex::getLayout();
+		if (m_renderingMode == QuadRenderingMode::Instanced) {
+			m_quadVertexBuffer = VertexBuffer::create(maxQuads * sizeof(QuadInstance));
+			m_quadVertexBuffer->layout = QuadInstance::getLayout();
+			m_quadVertexBuffer->perInstance = true;
+			m_qibBase = new QuadInstance[maxQuads];
+		} else {
+			m_quadVertexBuffer = VertexBuffer::create(maxVertices * sizeof(QuadVertex));
+			m_quadVertexBuffer->layout = QuadVertex::getLayout();
+			m_qvbBase = new QuadVertex[maxVertices];
+		}
 		m_quadVertexArray->addVertexBuffer(m_quadVertexBuffer);
 
-		m_qvbBase = new QuadVertex[maxVertices];
 		auto quadIndices = new uint32_t[maxIndices];
 
 		uint32_t offset = 0;
@@ -67,6 +74,12 @@ namespace MRG::OpenGL
 		}
 
 		delete[] m_qvbBase;
+		delete[] m_qibBase;
+
+		for (auto& queries : m_timerQueries) {
+			glDeleteQueries(static_cast<GLsizei>(queries.size()), queries.data());
+			queries.clear();
+		}
 	}
 
 	void Renderer2D::onWindowResize(uint32_t width, uint32_t height) { setViewport(0, 0, width, height); }
@@ -75,6 +88,8 @@ namespace MRG::OpenGL
 	{
 		MRG_PROFILE_FUNCTION()
 
+		readTimerQueries();
+
 		return true;
 	}
 
@@ -82,6 +97,8 @@ namespace MRG::OpenGL
 	{
 		MRG_PROFILE_FUNCTION()
 
+		m_timerQueryFrame = (m_timerQueryFrame + 1) % timerQueryLatency;
+
 		return true;
 	}
 
@@ -98,6 +115,7 @@ namespace MRG::OpenGL
 
 		m_quadIndexCount = 0;
 		m_qvbPtr = m_qvbBase;
+		m_qibPtr = m_qibBase;
 
 		m_textureSlotindex = 1;
 		m_sceneInProgress = true;
@@ -114,6 +132,7 @@ namespace MRG::OpenGL
 
 		m_quadIndexCount = 0;
 		m_qvbPtr = m_qvbBase;
+		m_qibPtr = m_qibBase;
 
 		m_textureSlotindex = 1;
 		m_sceneInProgress = true;
@@ -123,140 +142,88 @@ namespace MRG::OpenGL
 	{
 		MRG_PROFILE_FUNCTION()
 
-		auto dataSize = static_cast<uint32_t>((uint8_t*)m_qvbPtr - (uint8_t*)m_qvbBase);
-		m_quadVertexBuffer->setData(m_qvbBase, dataSize);
+		beginGPUPass(GPUPass::Scene);
+
+		if (m_renderingMode == QuadRenderingMode::Instanced) {
+			auto dataSize = static_cast<uint32_t>((uint8_t*)m_qibPtr - (uint8_t*)m_qibBase);
+			m_quadVertexBuffer->setData(m_qibBase, dataSize);
+		} else {
+			auto dataSize = static_cast<uint32_t>((uint8_t*)m_qvbPtr - (uint8_t*)m_qvbBase);
+			m_quadVertexBuffer->setData(m_qvbBase, dataSize);
+		}
 
 		flush();
+		endGPUPass();
 		m_sceneInProgress = false;
 	}
 
-	void Renderer2D::drawQuad(const glm::mat4& transform, const glm::vec4& color, uint32_t objectID)
+	void Renderer2D::setRenderTarget(Ref<MRG::Framebuffer> renderTarget)
 	{
-		const float texIndex = 0.0f;
-		const float tilingFactor = 1.0f;
-
-		if (m_quadIndexCount >= maxIndices) {
-			flushAndReset();
+		if (renderTarget == nullptr) {
+			resetRenderTarget();
+			return;
 		}
 
-		for (std::size_t i = 0; i < m_quadVertexCount; ++i) {
-			m_qvbPtr->position = transform * m_quadVertexPositions[i];
-			m_qvbPtr->color = color;
-			m_qvbPtr->texCoord = m_textureCoordinates[i];
-			m_qvbPtr->texIndex = texIndex;
-			m_qvbPtr->tilingFactor = tilingFactor;
-			m_qvbPtr->objectID = objectID;
-			++m_qvbPtr;
+		if (m_sceneInProgress) {
+			flushAndReset();
 		}
 
-		m_quadIndexCount += 6;
-		++m_stats.quadCount;
+		m_framebuffer = std::static_pointer_cast<Framebuffer>(renderTarget);
+		m_framebuffer->bind();
 	}
 
-	void
-	Renderer2D::drawQuad(const glm::mat4& transform, const Ref<MRG::Texture2D>& texture, float tilingFactor, const glm::vec4& tintColor)
+	void Renderer2D::resetRenderTarget()
 	{
-		if (m_quadIndexCount >= maxIndices) {
+		if (m_sceneInProgress) {
 			flushAndReset();
 		}
 
-		float texIndex = 0.f;
-		for (uint32_t i = 0; i < m_textureSlotindex; ++i) {
-			if (*m_textureSlots[i] == *texture) {
-				texIndex = static_cast<float>(i);
-				break;
-			}
-		}
-
-		if (texIndex == 0.f) {
-			if (m_textureSlotindex >= maxTextureSlots) {
-				flushAndReset();
-			}
-
-			texIndex = static_cast<float>(m_textureSlotindex);
-			m_textureSlots[m_textureSlotindex] = texture;
-			++m_textureSlotindex;
-		}
-
-		for (std::size_t i = 0; i < m_quadVertexCount; ++i) {
-			m_qvbPtr->position = transform * m_quadVertexPositions[i];
-			m_qvbPtr->color = tintColor;
-			m_qvbPtr->texCoord = m_textureCoordinates[i];
-			m_qvbPtr->texIndex = texIndex;
-			m_qvbPtr->tilingFactor = tilingFactor;
-			++m_qvbPtr;
-		}
-
-		m_quadIndexCount += 6;
-		++m_stats.quadCount;
-	}
-
-	void Renderer2D::drawQuad(const glm::vec3& position, const glm::vec2& size, const glm::vec4& color)
-	{
-		auto transform = glm::translate(glm::mat4{1.f}, position) * glm::scale(glm::mat4{1.f}, {size.x, size.y, 1.f});
-
-		drawQuad(transform, color, 0);
-	}
-
-	void Renderer2D::drawQuad(
-	  const glm::vec3& position, const glm::vec2& size, const Ref<MRG::Texture2D>& texture, float tilingFactor, const glm::vec4& tintColor)
-	{
-		auto transform = glm::translate(glm::mat4{1.f}, position) * glm::scale(glm::mat4{1.f}, {size.x, size.y, 1.f});
-
-		drawQuad(transform, texture, tilingFactor, tintColor);
-	}
-
-	void Renderer2D::drawRotatedQuad(const glm::vec3& position, const glm::vec2& size, float rotation, const glm::vec4& color)
-	{
-		auto transform = glm::translate(glm::mat4{1.f}, position) * glm::scale(glm::mat4{1.f}, {size.x, size.y, 1.f}) *
-		                 glm::rotate(glm::mat4{1.f}, rotation, {0.f, 0.f, 1.f});
-
-		// TODO: This will completely break, but we're not exposing this for now. Fix it before everything breaks please.
-		drawQuad(transform, color, 0);
+		m_framebuffer->unbind();
+		m_framebuffer = nullptr;
 	}
 
-	void Renderer2D::drawRotatedQuad(const glm::vec3& position,
-	                                 const glm::vec2& size,
-	                                 float rotation,
-	                                 const Ref<MRG::Texture2D>& texture,
-	                                 float tilingFactor,
-	                                 const glm::vec4& tintColor)
+	void Renderer2D::clear()
 	{
-		auto transform = glm::translate(glm::mat4{1.f}, position) * glm::scale(glm::mat4{1.f}, {size.x, size.y, 1.f}) *
-		                 glm::rotate(glm::mat4{1.f}, rotation, {0.f, 0.f, 1.f});
-
-		// TODO: This will completely break, but we're not exposing this for now. Fix it before everything breaks please.
-		drawQuad(transform, texture, tilingFactor, tintColor);
+		beginGPUPass(GPUPass::Clearing);
+		glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+		endGPUPass();
 	}
 
-	void Renderer2D::setRenderTarget(Ref<MRG::Framebuffer> renderTarget)
+	void Renderer2D::beginGPUPass(GPUPass pass)
 	{
-		if (renderTarget == nullptr) {
-			resetRenderTarget();
+		if (m_timerQueryActive) {
 			return;
 		}
 
-		if (m_sceneInProgress) {
-			flushAndReset();
+		auto& queries = m_timerQueries[m_timerQueryFrame];
+		auto& passes = m_timerQueryPasses[m_timerQueryFrame];
+		if (passes.size() == queries.size()) {
+			GLuint query;
+			glGenQueries(1, &query);
+			queries.push_back(query);
 		}
 
-		m_framebuffer = std::static_pointer_cast<Framebuffer>(renderTarget);
-		m_framebuffer->bind();
+		glBeginQuery(GL_TIME_ELAPSED, queries[passes.size()]);
+		passes.push_back(pass);
+		m_timerQueryActive = true;
 	}
 
-	void Renderer2D::resetRenderTarget()
+	void Renderer2D::endGPUPass()
 	{
-		if (m_sceneInProgress) {
-			flushAndReset();
+		if (!m_timerQueryActive) {
+			return;
 		}
 
-		m_framebuffer->unbind();
-		m_framebuffer = nullptr;
+		glEndQuery(GL_TIME_ELAPSED);
+		m_timerQueryActive = false;
 	}
 
-	void Renderer2D::resetStats() { m_stats = {}; }
-
-	RenderingStatistics Renderer2D::getStats() const { return m_stats; }
+	RenderingStatistics Renderer2D::getStats() const
+	{
+		auto stats = m_stats;
+		stats.gpuPassTimes = m_gpuPassTimes;
+		return stats;
+	}
 
 	void Renderer2D::flush()
 	{
@@ -266,7 +233,11 @@ namespace MRG::OpenGL
 
 		for (uint32_t i = 0; i < m_textureSlotindex; ++i) { m_textureSlots[i]->bind(i); }
 
-		drawIndexed(m_quadVertexArray, m_quadIndexCount);
+		if (m_renderingMode == QuadRenderingMode::Instanced) {
+			drawInstanced(m_quadVertexArray, m_quadIndexCount / 6);
+		} else {
+			drawIndexed(m_quadVertexArray, m_quadIndexCount);
+		}
 		++m_stats.drawCalls;
 	}
 
@@ -276,6 +247,7 @@ namespace MRG::OpenGL
 
 		m_quadIndexCount = 0;
 		m_qvbPtr = m_qvbBase;
+		m_qibPtr = m_qibBase;
 		m_textureSlotindex = 1;
 	}
 
@@ -289,4 +261,45 @@ namespace MRG::OpenGL
 		glBindTexture(GL_TEXTURE_2D, 0);
 	}
 
+	void Renderer2D::drawInstanced(const Ref<VertexArray>& vertexArray, uint32_t instanceCount)
+	{
+		MRG_PROFILE_FUNCTION()
+
+		vertexArray->bind();
+		glDrawArraysInstanced(GL_TRIANGLES, 0, 6, instanceCount);
+		glBindTexture(GL_TEXTURE_2D, 0);
+	}
+
+	void Renderer2D::readTimerQueries()
+	{
+		MRG_PROFILE_FUNCTION()
+
+		auto& passes = m_timerQueryPasses[m_timerQueryFrame];
+		if (passes.empty()) {
+			return;
+		}
+
+		// Results are only published when the whole frame is available, so that a pass is never reported partially
+		const auto& queries = m_timerQueries[m_timerQueryFrame];
+		GLint available = GL_TRUE;
+		for (std::size_t i = 0; i < passes.size() && available == GL_TRUE; ++i) {
+			glGetQueryObjectiv(queries[i], GL_QUERY_RESULT_AVAILABLE, &available);
+		}
+
+		if (available == GL_TRUE) {
+			std::array<GLuint64, RenderingStatistics::gpuPassCount> passDurations{};
+			for (std::size_t i = 0; i < passes.size(); ++i) {
+				GLuint64 duration = 0;
+				glGetQueryObjectui64v(queries[i], GL_QUERY_RESULT, &duration);
+				passDurations[static_cast<std::size_t>(passes[i])] += duration;
+			}
+
+			for (std::size_t i = 0; i < passDurations.size(); ++i) {
+				m_gpuPassTimes[i] = static_cast<float>(static_cast<double>(passDurations[i]) / 1000000.0);
+				MRG_PROFILE_GPU_TIME(getGPUPassName(static_cast<GPUPass>(i)), static_cast<int64_t>(passDurations[i]))
+			}
+		}
+		passes.clear();
+	}
+
 }  // namespace MRG::OpenGL
@@ -11,6 +11,7 @@
 
 #include <array>
 #include <glad/glad.h>
+#include <vector>
 
 namespace MRG::OpenGL
 {
@@ -31,50 +32,44 @@ namespace MRG::OpenGL
 		void beginScene(const EditorCamera& camera) override;
 		void endScene() override;
 
-		void drawQuad(const glm::mat4& transform, const glm::vec4& color, uint32_t objectID) override;
-		void
-		drawQuad(const glm::mat4& transform, const Ref<MRG::Texture2D>& texture, float tilingFactor, const glm::vec4& tintColor) override;
-
-		void drawQuad(const glm::vec3& position, const glm::vec2& size, const glm::vec4& color) override;
-		void drawQuad(const glm::vec3& position,
-		              const glm::vec2& size,
-		              const Ref<MRG::Texture2D>& texture,
-		              float tilingFactor,
-		              const glm::vec4& tintColor) override;
-
-		void drawRotatedQuad(const glm::vec3& position, const glm::vec2& size, float rotation, const glm::vec4& color) override;
-		void drawRotatedQuad(const glm::vec3& position,
-		                     const glm::vec2& size,
-		                     float rotation,
-		                     const Ref<MRG::Texture2D>& texture,
-		                     float tilingFactor,
-		                     const glm::vec4& tintColor) override;
-
 		void setRenderTarget(Ref<MRG::Framebuffer> renderTarget) override;
 		void resetRenderTarget() override;
 		[[nodiscard]] Ref<MRG::Framebuffer> getRenderTarget() const override { return m_framebuffer; }
 
 		void setViewport(uint32_t x, uint32_t y, uint32_t width, uint32_t height) override { glViewport(x, y, width, height); }
 		void setClearColor(const glm::vec4& color) override { glClearColor(color.r, color.g, color.b, color.a); }
-		void clear() override { glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT); }
+		void clear() override;
+
+		void beginGPUPass(GPUPass pass) override;
+		void endGPUPass() override;
 
-		void resetStats() override;
 		RenderingStatistics getStats() const override;
 
 	private:
 		void flush();
-		void flushAndReset();
+		void flushAndReset() override;
 		static void drawIndexed(const Ref<VertexArray>& vertexArray, uint32_t count = 0);
+		static void drawInstanced(const Ref<VertexArray>& vertexArray, uint32_t instanceCount);
+		// Never waits on the GPU, the queries that are not available yet are dropped
+		void readTimerQueries();
+
+		// Number of frames after which timer queries are read back
+		static const uint32_t timerQueryLatency = 3;
 
 		Ref<MRG::VertexArray> m_quadVertexArray;
 		Ref<MRG::VertexBuffer> m_quadVertexBuffer;
 		Ref<MRG::Shader> m_textureShader;
 		Ref<MRG::Texture2D> m_whiteTexture;
 
-		RenderingStatistics m_stats;
-
 		Ref<Framebuffer> m_framebuffer = nullptr;
 		bool m_sceneInProgress = false;
+
+		// GL_TIME_ELAPSED queries can't be nested, so only the outermost pass is timed when passes overlap
+		std::array<std::vector<GLuint>, timerQueryLatency> m_timerQueries;
+		std::array<std::vector<GPUPass>, timerQueryLatency> m_timerQueryPasses;
+		uint32_t m_timerQueryFrame = 0;
+		bool m_timerQueryActive = false;
+		std::array<float, RenderingStatistics::gpuPassCount> m_gpuPassTimes{};
 	};
 }  // namespace MRG::OpenGL
 
@@ -2,6 +2,7 @@
 
 #include "Core/Warnings.h"
 #include "Debug/Instrumentor.h"
+#include "Renderer/Renderer2D.h"
 
 #include <array>
 #include <filesystem>
@@ -50,6 +51,43 @@ namespace
 			return "\0";
 		}
 	}
+
+	// Vertex stage used in instanced mode by the shaders that don't provide an "instanced_vertex" section, as it only depends on
+	// the layout of QuadInstance. Its Vulkan counterpart is Renderer/Shaders/vk_instanced.vert.
+	// clang-format off
+	constexpr const char* defaultInstancedVertexSource = R"(#version 450 core
+
+layout(location = 0) in vec3 a_transformX;
+layout(location = 1) in vec3 a_transformY;
+layout(location = 2) in vec3 a_translation;
+layout(location = 3) in vec4 a_color;
+layout(location = 4) in vec4 a_texRect;
+layout(location = 5) in float a_texIndex;
+layout(location = 6) in float a_tilingFactor;
+
+uniform mat4 u_viewProjection;
+
+out vec4 v_color;
+out vec2 v_texCoord;
+out flat float v_texIndex;
+out float v_tilingFactor;
+
+// Same winding as the index buffer used by the batched mode (0, 1, 2, 2, 3, 0)
+const vec2 corners[6] = vec2[](vec2(0.0, 0.0), vec2(1.0, 0.0), vec2(1.0, 1.0), vec2(1.0, 1.0), vec2(0.0, 1.0), vec2(0.0, 0.0));
+
+void main()
+{
+	vec2 corner = corners[gl_VertexID];
+	vec3 position = a_transformX * (corner.x - 0.5) + a_transformY * (corner.y - 0.5) + a_translation;
+
+	v_color = a_color;
+	v_texCoord = a_texRect.xy + corner * a_texRect.zw;
+	v_texIndex = a_texIndex;
+	v_tilingFactor = a_tilingFactor;
+	gl_Position = u_viewProjection * vec4(position, 1.0);
+}
+)";
+	// clang-format on
 }  // namespace
 
 namespace MRG::OpenGL
@@ -200,6 +238,7 @@ namespace MRG::OpenGL
 		MRG_PROFILE_FUNCTION()
 
 		std::unordered_map<GLenum, std::string> shaderSources;
+		std::string instancedVertexSource;
 		auto newLineChar = returnCharFromEncoding(encoding);
 
 		constexpr const char* typeToken = "#type";
@@ -211,15 +250,21 @@ namespace MRG::OpenGL
 			MRG_CORE_ASSERT(eol != std::string::npos, fmt::format("Invalid syntax in shader '{}'!", m_name))
 			std::size_t begin = pos + typeTokenLength + 1;
 			std::string type = source.substr(begin, eol - begin);
-			MRG_CORE_ASSERT(shaderTypeFromString(type),
+			const auto isInstancedVertex = type == "instanced_vertex";
+			MRG_CORE_ASSERT(isInstancedVertex || shaderTypeFromString(type),
 			                fmt::format("Invalid shader type '{}' in shader preprocessing type definition!", type))
 
 			std::size_t nextLine = source.find_first_not_of(newLineChar, eol);
 			MRG_CORE_ASSERT(nextLine != std::string::npos, "Syntax Error")
 			pos = source.find(typeToken, nextLine);
 
-			shaderSources[shaderTypeFromString(type)] =
-			  (pos == std::string::npos) ? source.substr(nextLine) : source.substr(nextLine, pos - nextLine);
+			auto& destination = isInstancedVertex ? instancedVertexSource : shaderSources[shaderTypeFromString(type)];
+			destination = (pos == std::string::npos) ? source.substr(nextLine) : source.substr(nextLine, pos - nextLine);
+		}
+
+		// In instanced mode, quads are expanded by a dedicated vertex stage that replaces the regular one.
+		if (MRG::Renderer2D::getQuadRenderingMode() == QuadRenderingMode::Instanced) {
+			shaderSources[GL_VERTEX_SHADER] = instancedVertexSource.empty() ? defaultInstancedVertexSource : instancedVertexSource;
 		}
 
 		return shaderSources;
@@ -87,6 +87,9 @@ namespace MRG::OpenGL
 			                      element.isNormalized ? GL_TRUE : GL_FALSE,
 			                      layout.getStride(),
 			                      (const void*)(element.offset));
+			if (vertexBuffer->perInstance) {
+				glVertexAttribDivisor(index, 1);
+			}
 			++index;
 		}
 
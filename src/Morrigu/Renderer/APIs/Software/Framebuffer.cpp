@@ -0,0 +1,75 @@
+#include "Framebuffer.h"
+
+#include "Debug/Instrumentor.h"
+
+namespace MRG::Software
+{
+	Framebuffer::Framebuffer(const FramebufferSpecification& spec)
+	{
+		MRG_PROFILE_FUNCTION()
+
+		m_specification = spec;
+		for (const auto& attachment : m_specification.attachments.attachments) {
+			if (!isDepthFormat(attachment.textureFormat)) {
+				m_colorAttachmentsSpecifications.emplace_back(attachment);
+			} else {
+				m_depthAttachmentsSpecification = attachment;
+			}
+		}
+
+		invalidate();
+	}
+
+	void Framebuffer::destroy()
+	{
+		if (m_isDestroyed) {
+			return;
+		}
+
+		m_colorAttachments = {};
+		m_depthAttachment = {};
+		m_objectIDAttachment = {};
+		m_isDestroyed = true;
+	}
+
+	void Framebuffer::resize(uint32_t width, uint32_t height)
+	{
+		MRG_PROFILE_FUNCTION()
+
+		m_specification.width = width;
+		m_specification.height = height;
+
+		invalidate();
+	}
+
+	void Framebuffer::invalidate()
+	{
+		MRG_PROFILE_FUNCTION()
+
+		const auto pixelCount = static_cast<std::size_t>(m_specification.width) * m_specification.height;
+
+		m_colorAttachments.assign(m_colorAttachmentsSpecifications.size(), std::vector<uint8_t>(pixelCount * 4));
+		if (m_depthAttachmentsSpecification.textureFormat != FramebufferTextureFormat::None) {
+			m_depthAttachment.assign(pixelCount, 1.f);
+		} else {
+			m_depthAttachment.clear();
+		}
+		m_objectIDAttachment.assign(pixelCount, noObjectID);
+	}
+
+	void Framebuffer::clear(const glm::vec4& color)
+	{
+		MRG_PROFILE_FUNCTION()
+
+		const std::array<uint8_t, 4> clearValue = {
+		  packColorChannel(color.r), packColorChannel(color.g), packColorChannel(color.b), packColorChannel(color.a)};
+
+		for (auto& attachment : m_colorAttachments) {
+			for (std::size_t i = 0; i < attachment.size(); i += 4) {
+				std::copy(clearValue.begin(), clearValue.end(), attachment.begin() + i);
+			}
+		}
+		std::fill(m_depthAttachment.begin(), m_depthAttachment.end(), 1.f);
+		std::fill(m_objectIDAttachment.begin(), m_objectIDAttachment.end(), noObjectID);
+	}
+}  // namespace MRG::Software
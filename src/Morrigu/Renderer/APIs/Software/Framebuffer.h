@@ -0,0 +1,66 @@
+#ifndef MRG_SOFTWARE_IMPL_FRAMEBUFFER
+#define MRG_SOFTWARE_IMPL_FRAMEBUFFER
+
+#include "Renderer/Framebuffer.h"
+
+#include <algorithm>
+#include <limits>
+#include <vector>
+
+namespace MRG::Software
+{
+	// Converts a [0, 1] color channel to its RGBA8 representation
+	[[nodiscard]] inline uint8_t packColorChannel(float channel)
+	{
+		return static_cast<uint8_t>(std::clamp(channel, 0.f, 1.f) * 255.f + 0.5f);
+	}
+
+	// Every color attachment is stored as RGBA8 (RGBA16 attachments included), rows going from the top to the bottom of the image.
+	// Quads are rasterized into the first color attachment, the other ones are only cleared since there are no shaders to fill them.
+	// On top of the requested attachments, every framebuffer stores the objectID of the quad covering each pixel.
+	class Framebuffer : public MRG::Framebuffer
+	{
+	public:
+		// Value of the pixels not covered by any quad in the object ID attachment
+		static constexpr uint32_t noObjectID = std::numeric_limits<uint32_t>::max();
+
+		explicit Framebuffer(const FramebufferSpecification& spec);
+		Framebuffer(const Framebuffer&) = delete;
+		Framebuffer(Framebuffer&&) = delete;
+		~Framebuffer() override = default;
+
+		Framebuffer& operator=(const Framebuffer&) = delete;
+		Framebuffer& operator=(Framebuffer&&) = delete;
+
+		void destroy() override;
+		void resize(uint32_t width, uint32_t height) override;
+
+		void invalidate();
+		void clear(const glm::vec4& color);
+
+		[[nodiscard]] ImTextureID getImTextureID(uint32_t) override { return nullptr; }
+		[[nodiscard]] const std::array<ImVec2, 2>& getUVMapping() const override { return m_UVMapping; }
+
+		[[nodiscard]] const FramebufferSpecification& getSpecification() const override { return m_specification; }
+
+		[[nodiscard]] std::size_t getColorAttachmentCount() const { return m_colorAttachments.size(); }
+		[[nodiscard]] std::vector<uint8_t>& getColorAttachment(std::size_t index) { return m_colorAttachments[index]; }
+		[[nodiscard]] const std::vector<uint8_t>& getColorAttachment(std::size_t index) const { return m_colorAttachments[index]; }
+		// Empty when the specification has no depth attachment, in which case depth testing is disabled
+		[[nodiscard]] std::vector<float>& getDepthAttachment() { return m_depthAttachment; }
+		[[nodiscard]] std::vector<uint32_t>& getObjectIDAttachment() { return m_objectIDAttachment; }
+		[[nodiscard]] uint32_t getObjectIDAt(uint32_t x, uint32_t y) const
+		{
+			return m_objectIDAttachment[static_cast<std::size_t>(y) * m_specification.width + x];
+		}
+
+	private:
+		std::array<ImVec2, 2> m_UVMapping = {ImVec2{0, 0}, ImVec2{1, 1}};
+
+		std::vector<std::vector<uint8_t>> m_colorAttachments{};
+		std::vector<float> m_depthAttachment{};
+		std::vector<uint32_t> m_objectIDAttachment{};
+	};
+}  // namespace MRG::Software
+
+#endif
@@ -0,0 +1,322 @@
+#include "Rasterizer.h"
+
+#include "Debug/Instrumentor.h"
+
+#include <algorithm>
+#include <cmath>
+
+#if defined(__x86_64__) || defined(_M_X64)
+// SSE2 is part of the x86-64 baseline, so it does not need to be detected at runtime
+#define MRG_RASTERIZER_SSE2
+#include <emmintrin.h>
+#endif
+
+namespace
+{
+	// Number of quads set up by a single job
+	constexpr std::size_t setupChunkSize = 1024;
+
+	// Offsets of the pixel centers of the 4 pixels evaluated at once
+	constexpr std::array<float, 4> laneOffsets = {0.5f, 1.5f, 2.5f, 3.5f};
+
+	// Both triangles of a quad, following the index buffer of the GPU renderers
+	constexpr std::array<std::array<std::size_t, 3>, 2> quadTriangles = {std::array<std::size_t, 3>{0, 1, 2}, {2, 3, 0}};
+
+	struct ScreenVertex
+	{
+		float x, y, depth, invW;
+	};
+
+	// Repeat addressing mode with nearest filtering
+	[[nodiscard]] uint32_t wrapTexel(float coordinate, uint32_t size)
+	{
+		const auto wrapped = coordinate - std::floor(coordinate);
+		// Also catches NaNs, which degenerate triangles can produce
+		if (!(wrapped > 0.f)) {
+			return 0;
+		}
+
+		return std::min(static_cast<uint32_t>(wrapped * static_cast<float>(size)), size - 1);
+	}
+
+	[[nodiscard]] glm::vec4 sample(const MRG::Software::Texture2D& texture, const glm::vec2& texCoord)
+	{
+		const auto width = texture.getWidth();
+		const auto height = texture.getHeight();
+		if (width == 0 || height == 0) {
+			return glm::vec4{1.f};
+		}
+
+		const auto texelIndex = static_cast<std::size_t>(wrapTexel(texCoord.y, height)) * width + wrapTexel(texCoord.x, width);
+		const auto texel = texture.getPixels().data() + texelIndex * 4;
+
+		return glm::vec4(texel[0], texel[1], texel[2], texel[3]) / 255.f;
+	}
+}  // namespace
+
+namespace MRG::Software
+{
+	void Rasterizer::drawQuads(const QuadVertex* vertices,
+	                           std::size_t quadCount,
+	                           const glm::mat4& viewProjection,
+	                           const TextureSlots& textures,
+	                           Framebuffer& target)
+	{
+		MRG_PROFILE_FUNCTION()
+
+		const auto width = static_cast<int32_t>(target.getSpecification().width);
+		const auto height = static_cast<int32_t>(target.getSpecification().height);
+		if (quadCount == 0 || width == 0 || height == 0) {
+			return;
+		}
+
+		{
+			MRG_PROFILE_SCOPE("Triangle setup")
+
+			m_triangles.resize(quadCount * 2);
+			const auto chunkCount = (quadCount + setupChunkSize - 1) / setupChunkSize;
+			m_threadPool.parallelFor(chunkCount, [&](std::size_t chunk, std::size_t) {
+				const auto end = std::min((chunk + 1) * setupChunkSize, quadCount);
+				for (auto quad = chunk * setupChunkSize; quad < end; ++quad) {
+					setupQuad(vertices + quad * 4, viewProjection, textures, width, height, m_triangles.data() + quad * 2);
+				}
+			});
+		}
+
+		binTriangles(width, height);
+
+		MRG_PROFILE_SCOPE("Tile rasterization")
+
+		const TargetView view{(target.getColorAttachmentCount() != 0) ? target.getColorAttachment(0).data() : nullptr,
+		                      target.getDepthAttachment().empty() ? nullptr : target.getDepthAttachment().data(),
+		                      target.getObjectIDAttachment().data(),
+		                      width,
+		                      height};
+		m_threadPool.parallelFor(m_tileCount, [&](std::size_t tileIndex, std::size_t) { rasterizeTile(tileIndex, view); });
+	}
+
+	void Rasterizer::setupQuad(const QuadVertex* vertices,
+	                           const glm::mat4& viewProjection,
+	                           const TextureSlots& textures,
+	                           int32_t width,
+	                           int32_t height,
+	                           Triangle* triangles)
+	{
+		triangles[0].minX = triangles[1].minX = 1;
+		triangles[0].maxX = triangles[1].maxX = 0;
+
+		std::array<ScreenVertex, 4> screenVertices{};
+		for (std::size_t i = 0; i < screenVertices.size(); ++i) {
+			const auto clipPosition = viewProjection * glm::vec4{vertices[i].position, 1.f};
+			// There is no near plane clipping, so quads crossing the camera plane are dropped altogether
+			if (!(clipPosition.w > 0.f)) {
+				return;
+			}
+
+			const auto invW = 1.f / clipPosition.w;
+			screenVertices[i].x = (clipPosition.x * invW * 0.5f + 0.5f) * static_cast<float>(width);
+			screenVertices[i].y = (0.5f - clipPosition.y * invW * 0.5f) * static_cast<float>(height);
+			screenVertices[i].depth = clipPosition.z * invW;
+			screenVertices[i].invW = invW;
+		}
+
+		const auto textureSlot = std::min(static_cast<std::size_t>(vertices[0].texIndex), textures.size() - 1);
+		const auto texture = (textures[textureSlot] != nullptr) ? textures[textureSlot] : textures[0];
+
+		for (std::size_t t = 0; t < quadTriangles.size(); ++t) {
+			auto indices = quadTriangles[t];
+			auto& triangle = triangles[t];
+
+			const auto signedArea = [&]() {
+				const auto& a = screenVertices[indices[0]];
+				const auto& b = screenVertices[indices[1]];
+				const auto& c = screenVertices[indices[2]];
+				return (b.x - a.x) * (c.y - a.y) - (b.y - a.y) * (c.x - a.x);
+			};
+			auto area = signedArea();
+			// Faces are not culled, so back facing triangles are flipped to keep the edge functions positive inside
+			if (area < 0.f) {
+				std::swap(indices[1], indices[2]);
+				area = -area;
+			}
+			if (!(area > 0.f)) {
+				continue;
+			}
+
+			auto minX = screenVertices[indices[0]].x, maxX = minX;
+			auto minY = screenVertices[indices[0]].y, maxY = minY;
+			for (std::size_t i = 0; i < 3; ++i) {
+				const auto& vertex = screenVertices[indices[i]];
+				const auto* origin = &screenVertices[indices[(i + 1) % 3]];
+				const auto* destination = &screenVertices[indices[(i + 2) % 3]];
+				// Edges shared by two triangles must be evaluated from the same origin to get exactly opposite values, and
+				// have every pixel center covered by exactly one of them
+				auto direction = 1.f;
+				if (destination->y < origin->y || (destination->y == origin->y && destination->x < origin->x)) {
+					std::swap(origin, destination);
+					direction = -1.f;
+				}
+
+				triangle.edgeA[i] = direction * (origin->y - destination->y);
+				triangle.edgeB[i] = direction * (destination->x - origin->x);
+				triangle.originX[i] = origin->x;
+				triangle.originY[i] = origin->y;
+				triangle.isTopLeft[i] = triangle.edgeA[i] > 0.f || (triangle.edgeA[i] == 0.f && triangle.edgeB[i] > 0.f);
+
+				const auto& source = vertices[indices[i]];
+				triangle.depths[i] = vertex.depth;
+				triangle.invW[i] = vertex.invW;
+				triangle.colors[i] = source.color * vertex.invW;
+				triangle.texCoords[i] = source.texCoord * source.tilingFactor * vertex.invW;
+
+				minX = std::min(minX, vertex.x);
+				maxX = std::max(maxX, vertex.x);
+				minY = std::min(minY, vertex.y);
+				maxY = std::max(maxY, vertex.y);
+			}
+			triangle.invArea = 1.f / area;
+			triangle.texture = texture;
+			triangle.objectID = vertices[0].objectID;
+
+			// Clamped as floats first, as converting out of range values to integers is undefined
+			triangle.minX = static_cast<int32_t>(std::floor(std::clamp(minX, 0.f, static_cast<float>(width))));
+			triangle.maxX = static_cast<int32_t>(std::ceil(std::clamp(maxX, -1.f, static_cast<float>(width - 1))));
+			triangle.minY = static_cast<int32_t>(std::floor(std::clamp(minY, 0.f, static_cast<float>(height))));
+			triangle.maxY = static_cast<int32_t>(std::ceil(std::clamp(maxY, -1.f, static_cast<float>(height - 1))));
+			if (triangle.minY > triangle.maxY) {
+				triangle.maxX = triangle.minX - 1;
+			}
+		}
+	}
+
+	void Rasterizer::binTriangles(int32_t width, int32_t height)
+	{
+		MRG_PROFILE_FUNCTION()
+
+		m_tileCountX = (width + tileSize - 1) / tileSize;
+		m_tileCount = static_cast<std::size_t>(m_tileCountX) * ((height + tileSize - 1) / tileSize);
+		if (m_bins.size() < m_tileCount) {
+			m_bins.resize(m_tileCount);
+		}
+		for (std::size_t i = 0; i < m_tileCount; ++i) { m_bins[i].clear(); }
+
+		for (std::size_t i = 0; i < m_triangles.size(); ++i) {
+			const auto& triangle = m_triangles[i];
+			if (triangle.minX > triangle.maxX) {
+				continue;
+			}
+
+			for (auto tileY = triangle.minY / tileSize; tileY <= triangle.maxY / tileSize; ++tileY) {
+				for (auto tileX = triangle.minX / tileSize; tileX <= triangle.maxX / tileSize; ++tileX) {
+					m_bins[static_cast<std::size_t>(tileY) * m_tileCountX + tileX].push_back(static_cast<uint32_t>(i));
+				}
+			}
+		}
+	}
+
+	void Rasterizer::rasterizeTile(std::size_t tileIndex, const TargetView& target) const
+	{
+		const auto tileX = static_cast<int32_t>(tileIndex % m_tileCountX) * tileSize;
+		const auto tileY = static_cast<int32_t>(tileIndex / m_tileCountX) * tileSize;
+		const auto tileMaxX = std::min(tileX + tileSize, target.width) - 1;
+		const auto tileMaxY = std::min(tileY + tileSize, target.height) - 1;
+
+		std::array<std::array<float, 4>, 3> edges{};
+		for (const auto triangleIndex : m_bins[tileIndex]) {
+			const auto& triangle = m_triangles[triangleIndex];
+			const auto minX = std::max(triangle.minX, tileX);
+			const auto maxX = std::min(triangle.maxX, tileMaxX);
+			const auto minY = std::max(triangle.minY, tileY);
+			const auto maxY = std::min(triangle.maxY, tileMaxY);
+
+			for (auto y = minY; y <= maxY; ++y) {
+				for (auto x = minX; x <= maxX; x += 4) {
+					auto covered = evaluateEdges(triangle, x, y, edges);
+					if (maxX - x < 3) {
+						covered &= (1u << (maxX - x + 1)) - 1;
+					}
+
+					for (uint32_t lane = 0; covered != 0; ++lane, covered >>= 1) {
+						if ((covered & 1) != 0) {
+							shadePixel(triangle, x + lane, y, {edges[0][lane], edges[1][lane], edges[2][lane]}, target);
+						}
+					}
+				}
+			}
+		}
+	}
+
+	uint32_t Rasterizer::evaluateEdges(const Triangle& triangle, int32_t x, int32_t y, std::array<std::array<float, 4>, 3>& edges)
+	{
+#ifdef MRG_RASTERIZER_SSE2
+		const auto pixelX = _mm_add_ps(_mm_set1_ps(static_cast<float>(x)), _mm_loadu_ps(laneOffsets.data()));
+		const auto pixelY = _mm_set1_ps(static_cast<float>(y) + 0.5f);
+		const auto zero = _mm_setzero_ps();
+
+		auto covered = _mm_cmpeq_ps(zero, zero);
+		for (std::size_t i = 0; i < 3; ++i) {
+			const auto edge = _mm_add_ps(_mm_mul_ps(_mm_set1_ps(triangle.edgeA[i]), _mm_sub_ps(pixelX, _mm_set1_ps(triangle.originX[i]))),
+			                             _mm_mul_ps(_mm_set1_ps(triangle.edgeB[i]), _mm_sub_ps(pixelY, _mm_set1_ps(triangle.originY[i]))));
+			covered = _mm_and_ps(covered, triangle.isTopLeft[i] ? _mm_cmpge_ps(edge, zero) : _mm_cmpgt_ps(edge, zero));
+			_mm_storeu_ps(edges[i].data(), edge);
+		}
+
+		return static_cast<uint32_t>(_mm_movemask_ps(covered));
+#else
+		const auto pixelY = static_cast<float>(y) + 0.5f;
+
+		uint32_t covered = 0;
+		for (uint32_t lane = 0; lane < 4; ++lane) {
+			const auto pixelX = static_cast<float>(x) + laneOffsets[lane];
+
+			auto isCovered = true;
+			for (std::size_t i = 0; i < 3; ++i) {
+				const auto edge = triangle.edgeA[i] * (pixelX - triangle.originX[i]) + triangle.edgeB[i] * (pixelY - triangle.originY[i]);
+				isCovered = isCovered && (triangle.isTopLeft[i] ? edge >= 0.f : edge > 0.f);
+				edges[i][lane] = edge;
+			}
+			covered |= static_cast<uint32_t>(isCovered) << lane;
+		}
+
+		return covered;
+#endif
+	}
+
+	void Rasterizer::shadePixel(const Triangle& triangle, int32_t x, int32_t y, const std::array<float, 3>& edges, const TargetView& target)
+	{
+		const std::array<float, 3> weights = {edges[0] * triangle.invArea, edges[1] * triangle.invArea, edges[2] * triangle.invArea};
+
+		const auto depth = weights[0] * triangle.depths[0] + weights[1] * triangle.depths[1] + weights[2] * triangle.depths[2];
+		if (depth < 0.f || depth > 1.f) {
+			return;
+		}
+
+		const auto pixelIndex = static_cast<std::size_t>(y) * target.width + x;
+		if (target.depths != nullptr) {
+			if (!(depth < target.depths[pixelIndex])) {
+				return;
+			}
+			target.depths[pixelIndex] = depth;
+		}
+		target.objectIDs[pixelIndex] = triangle.objectID;
+
+		if (target.colors == nullptr) {
+			return;
+		}
+
+		const auto w = 1.f / (weights[0] * triangle.invW[0] + weights[1] * triangle.invW[1] + weights[2] * triangle.invW[2]);
+		auto color = (weights[0] * triangle.colors[0] + weights[1] * triangle.colors[1] + weights[2] * triangle.colors[2]) * w;
+		const auto texCoord =
+		  (weights[0] * triangle.texCoords[0] + weights[1] * triangle.texCoords[1] + weights[2] * triangle.texCoords[2]) * w;
+		color *= sample(*triangle.texture, texCoord);
+
+		// Same blending as the GPU pipelines: SRC_ALPHA / ONE_MINUS_SRC_ALPHA for colors, the source alpha is kept as is
+		const auto destination = target.colors + pixelIndex * 4;
+		const auto alpha = std::clamp(color.a, 0.f, 1.f);
+		for (std::size_t channel = 0; channel < 3; ++channel) {
+			const auto blended = color[channel] * alpha + (static_cast<float>(destination[channel]) / 255.f) * (1.f - alpha);
+			destination[channel] = packColorChannel(blended);
+		}
+		destination[3] = packColorChannel(color.a);
+	}
+}  // namespace MRG::Software
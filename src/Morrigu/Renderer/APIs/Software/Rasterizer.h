@@ -0,0 +1,87 @@
+#ifndef MRG_SOFTWARE_IMPL_RASTERIZER
+#define MRG_SOFTWARE_IMPL_RASTERIZER
+
+#include "Core/ThreadPool.h"
+#include "Renderer/APIs/Software/Framebuffer.h"
+#include "Renderer/APIs/Software/Textures.h"
+#include "Renderer/Renderer2D.h"
+
+#include <array>
+#include <vector>
+
+namespace MRG::Software
+{
+	// Bins the triangles of a batch into screen tiles, then rasterizes the tiles in parallel. Triangles are processed in submission
+	// order within a tile, and every pixel only depends on the triangles covering it, so the output does not depend on the number
+	// of threads. The pipeline mimics the one of the GPU renderers: depth test (less) and write, alpha blending, nearest filtering
+	// with repeating texture coordinates, no face culling.
+	class Rasterizer
+	{
+	public:
+		using TextureSlots = std::array<const Texture2D*, Generic2DRenderer::maxTextureSlots>;
+
+		static const int32_t tileSize = 32;
+
+		explicit Rasterizer(ThreadPool& threadPool) : m_threadPool(threadPool) {}
+
+		// vertices holds 4 vertices per quad, laid out like in the batched rendering mode. Texture indices are resolved using
+		// textures, where unused slots are expected to be null.
+		void drawQuads(const QuadVertex* vertices,
+		               std::size_t quadCount,
+		               const glm::mat4& viewProjection,
+		               const TextureSlots& textures,
+		               Framebuffer& target);
+
+	private:
+		struct Triangle
+		{
+			// Edge i is the one opposite to vertex i, and is positive inside the triangle:
+			// E(x, y) = edgeA * (x - originX) + edgeB * (y - originY)
+			std::array<float, 3> edgeA, edgeB, originX, originY;
+			// Top-left fill rule: pixel centers lying exactly on an edge are only covered if it is a top or left one
+			std::array<bool, 3> isTopLeft;
+			float invArea;
+
+			std::array<float, 3> depths;
+			std::array<float, 3> invW;
+			// Divided by w, for perspective correct interpolation
+			std::array<glm::vec4, 3> colors;
+			std::array<glm::vec2, 3> texCoords;
+
+			// Inclusive pixel bounds, clipped to the target. minX > maxX if the triangle does not need to be drawn.
+			int32_t minX, minY, maxX, maxY;
+			const Texture2D* texture;
+			uint32_t objectID;
+		};
+
+		struct TargetView
+		{
+			uint8_t* colors;
+			float* depths;
+			uint32_t* objectIDs;
+			int32_t width, height;
+		};
+
+		static void setupQuad(const QuadVertex* vertices,
+		                      const glm::mat4& viewProjection,
+		                      const TextureSlots& textures,
+		                      int32_t width,
+		                      int32_t height,
+		                      Triangle* triangles);
+		void binTriangles(int32_t width, int32_t height);
+		void rasterizeTile(std::size_t tileIndex, const TargetView& target) const;
+		// Evaluates the edge functions at the center of the 4 pixels starting at (x, y), and returns the mask of the covered ones
+		static uint32_t evaluateEdges(const Triangle& triangle, int32_t x, int32_t y, std::array<std::array<float, 4>, 3>& edges);
+		static void shadePixel(const Triangle& triangle, int32_t x, int32_t y, const std::array<float, 3>& edges, const TargetView& target);
+
+		ThreadPool& m_threadPool;
+
+		std::vector<Triangle> m_triangles;
+		// Indices of the triangles overlapping each tile, in submission order
+		std::vector<std::vector<uint32_t>> m_bins;
+		int32_t m_tileCountX = 0;
+		std::size_t m_tileCount = 0;
+	};
+}  // namespace MRG::Software
+
+#endif
@@ -0,0 +1,172 @@
+#include "Renderer2D.h"
+
+#include "Debug/Instrumentor.h"
+#include "Renderer/WindowProperties.h"
+
+#include <algorithm>
+#include <thread>
+
+namespace MRG::Software
+{
+	void Renderer2D::init()
+	{
+		MRG_PROFILE_FUNCTION()
+
+		if (m_renderingMode == QuadRenderingMode::Instanced) {
+			MRG_ENGINE_WARN("The software renderer does not support instanced rendering, using batched rendering instead.")
+			m_renderingMode = QuadRenderingMode::Batched;
+		}
+		m_qvbBase = new QuadVertex[maxVertices];
+
+		m_whiteTexture = Texture2D::create(1, 1);
+		auto whiteTextureData = 0xffffffff;
+		m_whiteTexture->setData(&whiteTextureData, sizeof(whiteTextureData));
+
+		m_textureSlots[0] = m_whiteTexture;
+
+		const auto threadCount = std::max(std::thread::hardware_concurrency(), 1u);
+		m_threadPool = createScope<ThreadPool>(threadCount - 1);
+		m_rasterizer = createScope<Rasterizer>(*m_threadPool);
+
+		FramebufferSpecification defaultSpecification{};
+		const auto window = MRG::Renderer2D::getGLFWWindow();
+		if (window != nullptr) {
+			const auto data = static_cast<WindowProperties*>(glfwGetWindowUserPointer(window));
+			defaultSpecification.width = data->width;
+			defaultSpecification.height = data->height;
+		}
+		defaultSpecification.attachments = {FramebufferTextureFormat::RGBA8, FramebufferTextureFormat::Depth};
+		m_defaultFramebuffer = createRef<Framebuffer>(defaultSpecification);
+
+		MRG_ENGINE_INFO("Using the software rendering API, with {} rasterization threads.", m_threadPool->getWorkerCount())
+	}
+
+	void Renderer2D::shutdown()
+	{
+		MRG_PROFILE_FUNCTION()
+
+		m_whiteTexture->destroy();
+
+		for (const auto& texture : m_textureSlots) {
+			if (texture != nullptr) {
+				texture->destroy();
+			}
+		}
+
+		if (m_framebuffer != nullptr) {
+			m_framebuffer->destroy();
+		}
+		m_defaultFramebuffer->destroy();
+
+		m_rasterizer.reset();
+		m_threadPool.reset();
+
+		delete[] m_qvbBase;
+	}
+
+	void Renderer2D::onWindowResize(uint32_t width, uint32_t height)
+	{
+		MRG_PROFILE_FUNCTION()
+
+		m_defaultFramebuffer->resize(width, height);
+	}
+
+	bool Renderer2D::beginFrame()
+	{
+		MRG_PROFILE_FUNCTION()
+
+		return true;
+	}
+
+	bool Renderer2D::endFrame()
+	{
+		MRG_PROFILE_FUNCTION()
+
+		return true;
+	}
+
+	void Renderer2D::beginScene(const Camera& camera, const glm::mat4& transform)
+	{
+		MRG_PROFILE_FUNCTION()
+
+		m_viewProjection = camera.getProjection() * glm::inverse(transform);
+
+		startBatch();
+		m_sceneInProgress = true;
+	}
+
+	void Renderer2D::beginScene(const EditorCamera& camera)
+	{
+		MRG_PROFILE_FUNCTION()
+
+		m_viewProjection = camera.getViewProjection();
+
+		startBatch();
+		m_sceneInProgress = true;
+	}
+
+	void Renderer2D::endScene()
+	{
+		MRG_PROFILE_FUNCTION()
+
+		flush();
+		m_sceneInProgress = false;
+	}
+
+	void Renderer2D::setRenderTarget(Ref<MRG::Framebuffer> renderTarget)
+	{
+		if (renderTarget == nullptr) {
+			resetRenderTarget();
+			return;
+		}
+
+		if (m_sceneInProgress) {
+			flushAndReset();
+		}
+
+		m_framebuffer = std::static_pointer_cast<Framebuffer>(renderTarget);
+	}
+
+	void Renderer2D::resetRenderTarget()
+	{
+		if (m_sceneInProgress) {
+			flushAndReset();
+		}
+
+		m_framebuffer = nullptr;
+	}
+
+	void Renderer2D::clear()
+	{
+		MRG_PROFILE_FUNCTION()
+
+		getCurrentTarget().clear(m_clearColor);
+	}
+
+	void Renderer2D::startBatch()
+	{
+		m_quadIndexCount = 0;
+		m_qvbPtr = m_qvbBase;
+		m_textureSlotindex = 1;
+	}
+
+	void Renderer2D::flush()
+	{
+		if (m_quadIndexCount == 0) {
+			return;
+		}
+
+		Rasterizer::TextureSlots textures{};
+		for (std::size_t i = 0; i < m_textureSlotindex; ++i) { textures[i] = static_cast<const Texture2D*>(m_textureSlots[i].get()); }
+
+		m_rasterizer->drawQuads(m_qvbBase, m_quadIndexCount / 6, m_viewProjection, textures, getCurrentTarget());
+		++m_stats.drawCalls;
+	}
+
+	void Renderer2D::flushAndReset()
+	{
+		// Unlike endScene, the scene stays in progress: the next render target change still has to flush the batch
+		flush();
+		startBatch();
+	}
+}  // namespace MRG::Software
@@ -0,0 +1,63 @@
+#ifndef MRG_SOFTWARE_IMPL_RENDERER2D
+#define MRG_SOFTWARE_IMPL_RENDERER2D
+
+#include "Core/ThreadPool.h"
+#include "Renderer/APIs/Software/Framebuffer.h"
+#include "Renderer/APIs/Software/Rasterizer.h"
+#include "Renderer/APIs/Software/Textures.h"
+#include "Renderer/Framebuffer.h"
+#include "Renderer/Renderer2D.h"
+
+namespace MRG::Software
+{
+	// Renders on the CPU, without needing a window nor a GPU. Nothing is presented: the result has to be read back from the render
+	// target (or from the default one, sized like the window, when no render target is set).
+	// As there is no vertex shader to expand them, quads are always rendered in batched mode.
+	class Renderer2D : public MRG::Generic2DRenderer
+	{
+	public:
+		virtual ~Renderer2D() = default;
+
+		void init() override;
+		void shutdown() override;
+
+		void onWindowResize(uint32_t width, uint32_t height) override;
+
+		bool beginFrame() override;
+		bool endFrame() override;
+
+		void beginScene(const Camera& camera, const glm::mat4& transform) override;
+		void beginScene(const EditorCamera& camera) override;
+		void endScene() override;
+
+		void setRenderTarget(Ref<MRG::Framebuffer> renderTarget) override;
+		void resetRenderTarget() override;
+		[[nodiscard]] Ref<MRG::Framebuffer> getRenderTarget() const override { return m_framebuffer; }
+		[[nodiscard]] Ref<Framebuffer> getDefaultRenderTarget() const { return m_defaultFramebuffer; }
+
+		// The whole render target is always used
+		void setViewport(uint32_t, uint32_t, uint32_t, uint32_t) override {}
+		void setClearColor(const glm::vec4& color) override { m_clearColor = color; }
+		void clear() override;
+
+	private:
+		void startBatch();
+		void flush();
+		void flushAndReset() override;
+		[[nodiscard]] Framebuffer& getCurrentTarget() const { return (m_framebuffer != nullptr) ? *m_framebuffer : *m_defaultFramebuffer; }
+
+		Ref<MRG::Texture2D> m_whiteTexture;
+
+		Scope<ThreadPool> m_threadPool;
+		Scope<Rasterizer> m_rasterizer;
+
+		glm::mat4 m_viewProjection{1.f};
+		glm::vec4 m_clearColor = {0.f, 0.f, 0.f, 1.f};
+
+		Ref<Framebuffer> m_framebuffer = nullptr;
+		Ref<Framebuffer> m_defaultFramebuffer = nullptr;
+		bool m_sceneInProgress = false;
+	};
+}  // namespace MRG::Software
+
+#endif
@@ -0,0 +1,53 @@
+#include "Textures.h"
+
+#include "Debug/Instrumentor.h"
+#include "Renderer/ImageLoader.h"
+
+#include <stb_image.h>
+
+#include <cstring>
+
+namespace MRG::Software
+{
+	Texture2D::Texture2D(uint32_t width, uint32_t height) : m_width(width), m_height(height), m_pixels(width * height * 4)
+	{
+		MRG_PROFILE_FUNCTION()
+	}
+
+	Texture2D::Texture2D(const std::string& path)
+	{
+		MRG_PROFILE_FUNCTION()
+
+		int width, height, channels;
+		stbi_uc* data = nullptr;
+		{
+			MRG_PROFILE_SCOPE("stbi_load - Software::Texture2D::Texture2D(const std::string&)")
+			data = ImageLoader::loadFromFile(path.c_str(), &width, &height, &channels, STBI_rgb_alpha, true);
+		}
+		MRG_CORE_ASSERT(data, fmt::format("Failed to load image '{}'!", path))
+
+		m_width = width;
+		m_height = height;
+		m_pixels.assign(data, data + m_width * m_height * 4);
+
+		stbi_image_free(data);
+	}
+
+	void Texture2D::destroy()
+	{
+		if (m_isDestroyed) {
+			return;
+		}
+
+		m_pixels = {};
+		m_isDestroyed = true;
+	}
+
+	void Texture2D::setData(void* data, uint32_t size)
+	{
+		MRG_PROFILE_FUNCTION()
+
+		MRG_CORE_ASSERT(size == m_width * m_height * 4, "Data must be entire texture!")
+		std::memcpy(m_pixels.data(), data, size);
+	}
+}  // namespace MRG::Software
@@ -0,0 +1,43 @@
+#ifndef MRG_SOFTWARE_IMPL_TEXTURES
+#define MRG_SOFTWARE_IMPL_TEXTURES
+
+#include "Renderer/Textures.h"
+
+#include <vector>
+
+namespace MRG::Software
+{
+	// Pixels are stored as RGBA8, with the first row being the bottom of the image (v = 0), like the other APIs
+	class Texture2D : public MRG::Texture2D
+	{
+	public:
+		Texture2D(uint32_t width, uint32_t height);
+		explicit Texture2D(const std::string& path);
+		Texture2D(const Texture2D&) = delete;
+		Texture2D(Texture2D&&) = delete;
+		~Texture2D() override = default;
+
+		Texture2D& operator=(const Texture2D&) = delete;
+		Texture2D& operator=(Texture2D&&) = delete;
+
+		bool operator==(const Texture& other) const override { return this == &other; }
+
+		void destroy() override;
+
+		[[nodiscard]] uint32_t getWidth() const override { return m_width; };
+		[[nodiscard]] uint32_t getHeight() const override { return m_height; };
+		[[nodiscard]] ImTextureID getImTextureID() override { return nullptr; };
+
+		void setData(void* data, uint32_t size) override;
+
+		void bind(uint32_t) const override {}
+
+		[[nodiscard]] const std::vector<uint8_t>& getPixels() const { return m_pixels; }
+
+	private:
+		uint32_t m_width = 0, m_height = 0;
+		std::vector<uint8_t> m_pixels;
+	};
+}  // namespace MRG::Software
+
+#endif
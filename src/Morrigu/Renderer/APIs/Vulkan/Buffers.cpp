@@ -12,12 +12,16 @@ namespace MRG::Vulkan
 
 		const auto data = static_cast<WindowProperties*>(glfwGetWindowUserPointer(Renderer2D::getGLFWWindow()));
 
+		// Dynamic vertex buffers are rewritten every frame, so they live in host visible memory, which the allocator keeps mapped.
+		// This avoids any staging buffer or queue wait when uploading new data.
 		MRG::Vulkan::createBuffer(data->device,
-		                          data->physicalDevice,
+		                          data->allocator,
 		                          size,
-		                          VK_BUFFER_USAGE_TRANSFER_DST_BIT | VK_BUFFER_USAGE_VERTEX_BUFFER_BIT,
-		                          VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT,
+		                          VK_BUFFER_USAGE_VERTEX_BUFFER_BIT,
+		                          VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT,
 		                          m_bufferStruct);
+
+		m_mappedData = m_bufferStruct.allocation.mappedData;
 	}
 
 	VertexBuffer::VertexBuffer(const void* vertices, uint32_t size)
@@ -26,30 +30,15 @@ namespace MRG::Vulkan
 
 		const auto data = static_cast<WindowProperties*>(glfwGetWindowUserPointer(Renderer2D::getGLFWWindow()));
 
-		MRG::Vulkan::Buffer stagingBuffer{};
-		MRG::Vulkan::createBuffer(data->device,
-		                          data->physicalDevice,
-		                          size,
-		                          VK_BUFFER_USAGE_TRANSFER_SRC_BIT,
-		                          VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT,
-		                          stagingBuffer);
-
-		void* dataPointer;
-		vkMapMemory(data->device, stagingBuffer.memoryHandle, 0, size, 0, &dataPointer);
-		memcpy(dataPointer, vertices, size);
-		vkUnmapMemory(data->device, stagingBuffer.memoryHandle);
-
 		MRG::Vulkan::createBuffer(data->device,
-		                          data->physicalDevice,
+		                          data->allocator,
 		                          size,
 		                          VK_BUFFER_USAGE_TRANSFER_DST_BIT | VK_BUFFER_USAGE_VERTEX_BUFFER_BIT,
 		                          VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT,
-		                          m_bufferStruct);
+		                          m_bufferStruct,
+		                          data->uploadContext.getSharingQueueFamilies());
 
-		MRG::Vulkan::copyBuffer(data, stagingBuffer, m_bufferStruct, size);
-
-		vkDestroyBuffer(data->device, stagingBuffer.handle, nullptr);
-		vkFreeMemory(data->device, stagingBuffer.memoryHandle, nullptr);
+		m_uploadTicket = data->uploadContext.uploadBuffer(vertices, size, m_bufferStruct.handle);
 	}
 
 	VertexBuffer::~VertexBuffer()
@@ -69,8 +58,13 @@ namespace MRG::Vulkan
 
 		const auto data = static_cast<WindowProperties*>(glfwGetWindowUserPointer(Renderer2D::getGLFWWindow()));
 
+		// The buffer can't be destroyed while the transfer queue still writes to it
+		data->uploadContext.wait(m_uploadTicket);
+		m_uploadTicket = 0;
+
+		m_mappedData = nullptr;
 		vkDestroyBuffer(data->device, m_bufferStruct.handle, nullptr);
-		vkFreeMemory(data->device, m_bufferStruct.memoryHandle, nullptr);
+		data->allocator.free(m_bufferStruct.allocation);
 		m_isDestroyed = true;
 	}
 
@@ -85,25 +79,23 @@ namespace MRG::Vulkan
 
 	void VertexBuffer::setData(const void* data, uint32_t size)
 	{
-		const auto windowData = static_cast<WindowProperties*>(glfwGetWindowUserPointer(Renderer2D::getGLFWWindow()));
-
-		MRG::Vulkan::Buffer stagingBuffer{};
-		MRG::Vulkan::createBuffer(windowData->device,
-		                          windowData->physicalDevice,
-		                          size,
-		                          VK_BUFFER_USAGE_TRANSFER_SRC_BIT,
-		                          VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT,
-		                          stagingBuffer);
+		if (m_mappedData != nullptr) {
+			if (data != m_mappedData) {
+				memcpy(m_mappedData, data, size);
+			}
+			return;
+		}
 
-		void* dataPointer;
-		vkMapMemory(windowData->device, stagingBuffer.memoryHandle, 0, size, 0, &dataPointer);
-		memcpy(dataPointer, data, size);
-		vkUnmapMemory(windowData->device, stagingBuffer.memoryHandle);
+		const auto windowData = static_cast<WindowProperties*>(glfwGetWindowUserPointer(Renderer2D::getGLFWWindow()));
+		m_uploadTicket = windowData->uploadContext.uploadBuffer(data, size, m_bufferStruct.handle);
+	}
 
-		MRG::Vulkan::copyBuffer(windowData, stagingBuffer, m_bufferStruct, size);
+	void VertexBuffer::waitUntilReady() const
+	{
+		MRG_PROFILE_FUNCTION()
 
-		vkDestroyBuffer(windowData->device, stagingBuffer.handle, nullptr);
-		vkFreeMemory(windowData->device, stagingBuffer.memoryHandle, nullptr);
+		const auto data = static_cast<WindowProperties*>(glfwGetWindowUserPointer(Renderer2D::getGLFWWindow()));
+		data->uploadContext.wait(m_uploadTicket);
 	}
 
 	//===================================================================================//
@@ -115,30 +107,15 @@ namespace MRG::Vulkan
 		const auto data = static_cast<WindowProperties*>(glfwGetWindowUserPointer(Renderer2D::getGLFWWindow()));
 		const auto bufferSize = count * sizeof(uint32_t);
 
-		MRG::Vulkan::Buffer stagingBuffer{};
-		MRG::Vulkan::createBuffer(data->device,
-		                          data->physicalDevice,
-		                          bufferSize,
-		                          VK_BUFFER_USAGE_TRANSFER_SRC_BIT,
-		                          VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT,
-		                          stagingBuffer);
-
-		void* dataPointer;
-		vkMapMemory(data->device, stagingBuffer.memoryHandle, 0, bufferSize, 0, &dataPointer);
-		memcpy(dataPointer, indices, bufferSize);
-		vkUnmapMemory(data->device, stagingBuffer.memoryHandle);
-
 		MRG::Vulkan::createBuffer(data->device,
-		                          data->physicalDevice,
+		                          data->allocator,
 		                          bufferSize,
 		                          VK_BUFFER_USAGE_TRANSFER_DST_BIT | VK_BUFFER_USAGE_INDEX_BUFFER_BIT,
 		                          VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT,
-		                          m_bufferStruct);
-
-		copyBuffer(data, stagingBuffer, m_bufferStruct, bufferSize);
+		                          m_bufferStruct,
+		                          data->uploadContext.getSharingQueueFamilies());
 
-		vkDestroyBuffer(data->device, stagingBuffer.handle, nullptr);
-		vkFreeMemory(data->device, stagingBuffer.memoryHandle, nullptr);
+		m_uploadTicket = data->uploadContext.uploadBuffer(indices, bufferSize, m_bufferStruct.handle);
 	}
 
 	IndexBuffer::~IndexBuffer()
@@ -158,8 +135,12 @@ namespace MRG::Vulkan
 
 		const auto data = static_cast<WindowProperties*>(glfwGetWindowUserPointer(Renderer2D::getGLFWWindow()));
 
+		// The buffer can't be destroyed while the transfer queue still writes to it
+		data->uploadContext.wait(m_uploadTicket);
+		m_uploadTicket = 0;
+
 		vkDestroyBuffer(data->device, m_bufferStruct.handle, nullptr);
-		vkFreeMemory(data->device, m_bufferStruct.memoryHandle, nullptr);
+		data->allocator.free(m_bufferStruct.allocation);
 		m_isDestroyed = true;
 	}
 
@@ -171,4 +152,12 @@ namespace MRG::Vulkan
 	{
 		// MRG_PROFILE_FUNCTION()
 	}
+
+	void IndexBuffer::waitUntilReady() const
+	{
+		MRG_PROFILE_FUNCTION()
+
+		const auto data = static_cast<WindowProperties*>(glfwGetWindowUserPointer(Renderer2D::getGLFWWindow()));
+		data->uploadContext.wait(m_uploadTicket);
+	}
 }  // namespace MRG::Vulkan
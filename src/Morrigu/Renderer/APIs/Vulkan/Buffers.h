@@ -23,13 +23,20 @@ namespace MRG::Vulkan
 		void bind() const override;
 		void unbind() const override;
 
+		// Static buffers are written by the upload context, the frames in flight must not be reading them anymore
 		void setData(const void* data, uint32_t size) override;
+		// Static buffers can only be drawn with once their upload is complete
+		void waitUntilReady() const;
 
 		[[nodiscard]] VkBuffer getHandle() const { return m_bufferStruct.handle; }
-		[[nodiscard]] VkDeviceMemory getMemoryHandle() const { return m_bufferStruct.memoryHandle; }
+		[[nodiscard]] VkDeviceMemory getMemoryHandle() const { return m_bufferStruct.allocation.memoryHandle; }
+		// Only dynamic buffers (created with a size only) are persistently mapped, static ones return nullptr.
+		[[nodiscard]] void* getMappedData() const { return m_mappedData; }
 
 	private:
 		Buffer m_bufferStruct{};
+		void* m_mappedData = nullptr;
+		uint64_t m_uploadTicket = 0;
 	};
 
 	class IndexBuffer : public MRG::IndexBuffer
@@ -48,14 +55,18 @@ namespace MRG::Vulkan
 		void bind() const override;
 		void unbind() const override;
 
+		// The buffer can only be drawn with once its upload is complete
+		void waitUntilReady() const;
+
 		[[nodiscard]] VkBuffer getHandle() const { return m_bufferStruct.handle; }
-		[[nodiscard]] VkDeviceMemory getMemoryHandle() const { return m_bufferStruct.memoryHandle; }
+		[[nodiscard]] VkDeviceMemory getMemoryHandle() const { return m_bufferStruct.allocation.memoryHandle; }
 
 		[[nodiscard]] uint32_t getCount() const override { return m_count; };
 
 	private:
 		Buffer m_bufferStruct{};
 		uint32_t m_count;
+		uint64_t m_uploadTicket = 0;
 	};
 }  // namespace MRG::Vulkan
 
@@ -3,7 +3,9 @@
 #include "Core/Window.h"
 #include "Debug/Instrumentor.h"
 #include "Renderer/APIs/Vulkan/Helper.h"
+#include "Renderer/Renderer2D.h"
 
+#include <algorithm>
 #include <map>
 #include <set>
 #include <vector>
@@ -57,6 +59,22 @@ namespace
 			++i;
 		}
 
+		// Families without graphics support are the copy engines, and the ones without compute support are preferred among them
+		for (uint32_t j = 0; j < queueFamilyCount; ++j) {
+			const auto flags = queueFamilies[j].queueFlags;
+			if ((flags & VK_QUEUE_TRANSFER_BIT) == 0 || (flags & VK_QUEUE_GRAPHICS_BIT) != 0) {
+				continue;
+			}
+
+			const auto isTransferOnly = (flags & VK_QUEUE_COMPUTE_BIT) == 0;
+			if (!indices.transferFamily.has_value() || isTransferOnly) {
+				indices.transferFamily = j;
+			}
+			if (isTransferOnly) {
+				break;
+			}
+		}
+
 		return indices;
 	}
 
@@ -137,7 +155,25 @@ namespace
 		createInfo.pfnUserCallback = debugCallback;
 	}
 
-	[[nodiscard]] VkInstance createInstance(const char* appName)
+	// Vulkan 1.2 is needed for descriptor indexing, but a 1.0 implementation refuses to create an instance asking for more than 1.0
+	[[nodiscard]] uint32_t chooseInstanceVersion()
+	{
+		// vkEnumerateInstanceVersion doesn't exist in 1.0 loaders, so it can't be called directly
+		const auto enumerateInstanceVersion =
+		  reinterpret_cast<PFN_vkEnumerateInstanceVersion>(vkGetInstanceProcAddr(nullptr, "vkEnumerateInstanceVersion"));
+		if (enumerateInstanceVersion == nullptr) {
+			return VK_API_VERSION_1_0;
+		}
+
+		uint32_t availableVersion = VK_API_VERSION_1_0;
+		if (enumerateInstanceVersion(&availableVersion) != VK_SUCCESS) {
+			return VK_API_VERSION_1_0;
+		}
+
+		return std::min(availableVersion, static_cast<uint32_t>(VK_API_VERSION_1_2));
+	}
+
+	[[nodiscard]] VkInstance createInstance(const char* appName, uint32_t apiVersion)
 	{
 		MRG_PROFILE_FUNCTION()
 
@@ -156,7 +192,7 @@ namespace
 		appInfo.engineVersion = VK_MAKE_VERSION(0, 1, 0);
 		appInfo.pApplicationName = appName;
 		appInfo.applicationVersion = VK_MAKE_VERSION(1, 0, 0);  // TODO: give option to create appropriate versions
-		appInfo.apiVersion = VK_API_VERSION_1_0;                // TODO: check if update may be necessary
+		appInfo.apiVersion = apiVersion;
 
 		const auto requiredExtensions = getRequiredExtensions();
 
@@ -310,6 +346,47 @@ namespace
 		return score;
 	}
 
+	// Descriptor indexing is core since Vulkan 1.2, and is required for the renderer to use a single texture table.
+	// Both the instance and the device have to support 1.2, otherwise the renderer falls back to per batch texture slots.
+	[[nodiscard]] bool checkTextureTableSupport(VkPhysicalDevice device, uint32_t instanceVersion)
+	{
+		if (instanceVersion < VK_API_VERSION_1_2) {
+			return false;
+		}
+
+		VkPhysicalDeviceProperties properties;
+		vkGetPhysicalDeviceProperties(device, &properties);
+		if (properties.apiVersion < VK_API_VERSION_1_2) {
+			return false;
+		}
+
+		VkPhysicalDeviceDescriptorIndexingFeatures indexingFeatures{};
+		indexingFeatures.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DESCRIPTOR_INDEXING_FEATURES;
+		VkPhysicalDeviceFeatures2 features{};
+		features.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FEATURES_2;
+		features.pNext = &indexingFeatures;
+		vkGetPhysicalDeviceFeatures2(device, &features);
+
+		if (indexingFeatures.shaderSampledImageArrayNonUniformIndexing == VK_FALSE ||
+		    indexingFeatures.descriptorBindingPartiallyBound == VK_FALSE ||
+		    indexingFeatures.descriptorBindingSampledImageUpdateAfterBind == VK_FALSE ||
+		    indexingFeatures.descriptorBindingUpdateUnusedWhilePending == VK_FALSE) {
+			return false;
+		}
+
+		VkPhysicalDeviceDescriptorIndexingProperties indexingProperties{};
+		indexingProperties.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DESCRIPTOR_INDEXING_PROPERTIES;
+		VkPhysicalDeviceProperties2 properties2{};
+		properties2.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PROPERTIES_2;
+		properties2.pNext = &indexingProperties;
+		vkGetPhysicalDeviceProperties2(device, &properties2);
+
+		return indexingProperties.maxPerStageDescriptorUpdateAfterBindSampledImages >= MRG::Vulkan::TextureTable::maxTextures &&
+		       indexingProperties.maxPerStageDescriptorUpdateAfterBindSamplers >= MRG::Vulkan::TextureTable::maxTextures &&
+		       indexingProperties.maxDescriptorSetUpdateAfterBindSampledImages >= MRG::Vulkan::TextureTable::maxTextures &&
+		       indexingProperties.maxDescriptorSetUpdateAfterBindSamplers >= MRG::Vulkan::TextureTable::maxTextures;
+	}
+
 	constexpr const char* vendorStringFromID(const uint32_t vendorID)
 	{
 		switch (vendorID) {
@@ -364,7 +441,7 @@ namespace
 		return candidates.rbegin()->second;
 	}
 
-	[[nodiscard]] VkDevice createDevice(VkPhysicalDevice physicalDevice, VkSurfaceKHR surface)
+	[[nodiscard]] VkDevice createDevice(VkPhysicalDevice physicalDevice, VkSurfaceKHR surface, bool enableTextureTable)
 	{
 		MRG_PROFILE_FUNCTION()
 
@@ -375,6 +452,9 @@ namespace
 
 		std::vector<VkDeviceQueueCreateInfo> queueCreateInfos{};
 		std::set<uint32_t> uniqueQueueFamilies = {indices.graphicsFamily.value(), indices.presentFamily.value()};
+		if (indices.transferFamily.has_value()) {
+			uniqueQueueFamilies.insert(indices.transferFamily.value());
+		}
 
 		for (auto queueFamily : uniqueQueueFamilies) {
 			VkDeviceQueueCreateInfo queueCreateInfo{};
@@ -390,6 +470,13 @@ namespace
 		VkPhysicalDeviceFeatures deviceFeatures{};
 		deviceFeatures.samplerAnisotropy = VK_TRUE;
 
+		VkPhysicalDeviceDescriptorIndexingFeatures indexingFeatures{};
+		indexingFeatures.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DESCRIPTOR_INDEXING_FEATURES;
+		indexingFeatures.shaderSampledImageArrayNonUniformIndexing = VK_TRUE;
+		indexingFeatures.descriptorBindingPartiallyBound = VK_TRUE;
+		indexingFeatures.descriptorBindingSampledImageUpdateAfterBind = VK_TRUE;
+		indexingFeatures.descriptorBindingUpdateUnusedWhilePending = VK_TRUE;
+
 		VkDeviceCreateInfo createInfo{};
 		createInfo.sType = VK_STRUCTURE_TYPE_DEVICE_CREATE_INFO;
 		createInfo.queueCreateInfoCount = static_cast<uint32_t>(queueCreateInfos.size());
@@ -397,6 +484,9 @@ namespace
 		createInfo.enabledExtensionCount = static_cast<uint32_t>(getDeviceExtensions().size());
 		createInfo.ppEnabledExtensionNames = getDeviceExtensions().data();
 		createInfo.pEnabledFeatures = &deviceFeatures;
+		if (enableTextureTable) {
+			createInfo.pNext = &indexingFeatures;
+		}
 		if (enableValidation) {
 			createInfo.enabledLayerCount = static_cast<uint32_t>(getValidationLayers().size());
 			createInfo.ppEnabledLayerNames = getValidationLayers().data();
@@ -425,7 +515,8 @@ namespace MRG::Vulkan
 
 		try {
 			auto data = static_cast<WindowProperties*>(glfwGetWindowUserPointer(window));
-			data->instance = createInstance(data->title);
+			const auto instanceVersion = chooseInstanceVersion();
+			data->instance = createInstance(data->title, instanceVersion);
 			MRG_ENGINE_INFO("Vulkan instance successfully created")
 
 			if (enableValidation) {
@@ -441,12 +532,28 @@ namespace MRG::Vulkan
 			MRG_ENGINE_INFO(
 			  "Physical device selected: {} {{ID{}}} ({})", props.deviceName, props.deviceID, vendorStringFromID(props.vendorID))
 
-			data->device = createDevice(data->physicalDevice, data->surface);
+			data->supportsTextureTable = checkTextureTableSupport(data->physicalDevice, instanceVersion);
+			MRG_ENGINE_INFO("Descriptor indexing {}, using {} for textures",
+			                data->supportsTextureTable ? "supported" : "not supported",
+			                data->supportsTextureTable ? "a single texture table" : "per batch texture slots")
+
+			data->device = createDevice(data->physicalDevice, data->surface, data->supportsTextureTable);
+			data->allocator.init(data->physicalDevice, data->device);
+			data->pipelineCache.init(data->physicalDevice, data->device, "MRGPipelineCache.bin");
 			auto queueFamilies = findQueueFamilies(data->physicalDevice, data->surface);
 			data->graphicsQueue.index = queueFamilies.graphicsFamily.value();
 			data->presentQueue.index = queueFamilies.presentFamily.value();
 			vkGetDeviceQueue(data->device, queueFamilies.graphicsFamily.value(), 0, &data->graphicsQueue.handle);
 			vkGetDeviceQueue(data->device, queueFamilies.presentFamily.value(), 0, &data->presentQueue.handle);
+			if (queueFamilies.transferFamily.has_value()) {
+				data->transferQueue.index = queueFamilies.transferFamily.value();
+				vkGetDeviceQueue(data->device, queueFamilies.transferFamily.value(), 0, &data->transferQueue.handle);
+			} else {
+				data->transferQueue = data->graphicsQueue;
+			}
+			MRG_ENGINE_INFO("Uploading resources through {}",
+			                queueFamilies.transferFamily.has_value() ? "a dedicated transfer queue" : "the graphics queue")
+			data->uploadContext.init(data->device, data->allocator, data->graphicsQueue, data->transferQueue);
 		} catch (const std::runtime_error& e) {
 			MRG_ENGINE_ERROR("Vulkan error detected: {}", e.what())
 		}
@@ -458,6 +565,9 @@ namespace MRG::Vulkan
 
 		auto data = static_cast<WindowProperties*>(glfwGetWindowUserPointer(m_window));
 
+		data->uploadContext.destroy();
+		data->pipelineCache.destroy();
+		data->allocator.destroy();
 		vkDestroyDevice(data->device, nullptr);
 
 		if (enableValidation) {
@@ -473,5 +583,15 @@ namespace MRG::Vulkan
 		// MRG_PROFILE_FUNCTION()
 	}
 
-	void Context::swapInterval(int) {}
+	void Context::swapInterval(int interval)
+	{
+		// The window sets its initial VSync before the renderer exists, which then reads it from the window properties
+		if (!MRG::Renderer2D::isInitialized()) {
+			return;
+		}
+
+		auto policy = MRG::Renderer2D::getPresentationPolicy();
+		policy.presentMode = (interval != 0) ? PresentMode::FIFO : PresentMode::Mailbox;
+		MRG::Renderer2D::setPresentationPolicy(policy);
+	}
 }  // namespace MRG::Vulkan
@@ -57,7 +57,7 @@ namespace MRG::Vulkan
 
 		VkAttachmentDescription colorAttachment{};
 		colorAttachment.samples = VK_SAMPLE_COUNT_1_BIT;
-		colorAttachment.loadOp = VK_ATTACHMENT_LOAD_OP_CLEAR;
+		colorAttachment.loadOp = VK_ATTACHMENT_LOAD_OP_LOAD;
 		colorAttachment.storeOp = VK_ATTACHMENT_STORE_OP_STORE;
 		colorAttachment.stencilLoadOp = VK_ATTACHMENT_LOAD_OP_DONT_CARE;
 		colorAttachment.stencilStoreOp = VK_ATTACHMENT_STORE_OP_DONT_CARE;
@@ -66,7 +66,7 @@ namespace MRG::Vulkan
 
 		VkAttachmentDescription depthAttachment{};
 		depthAttachment.samples = VK_SAMPLE_COUNT_1_BIT;
-		depthAttachment.loadOp = VK_ATTACHMENT_LOAD_OP_CLEAR;
+		depthAttachment.loadOp = VK_ATTACHMENT_LOAD_OP_LOAD;
 		depthAttachment.storeOp = VK_ATTACHMENT_STORE_OP_STORE;
 		depthAttachment.stencilLoadOp = VK_ATTACHMENT_LOAD_OP_DONT_CARE;
 		depthAttachment.stencilStoreOp = VK_ATTACHMENT_STORE_OP_DONT_CARE;
@@ -80,11 +80,7 @@ namespace MRG::Vulkan
 		                          depthAttachment,
 		                          std::static_pointer_cast<MRG::Vulkan::VertexArray>(data->vertexArray)->getAttributeDescriptions(),
 		                          {std::static_pointer_cast<MRG::Vulkan::VertexArray>(data->vertexArray)->getBindingDescription()}};
-		m_clearingPipeline.init(pipelineSpec);
-
-		pipelineSpec.colorAttachmentDescription.loadOp = VK_ATTACHMENT_LOAD_OP_LOAD;
-		pipelineSpec.depthAttachmentDescription.loadOp = VK_ATTACHMENT_LOAD_OP_LOAD;
-
+		// Clears are done by the clearing render pass of this pipeline, in place of the first pass recorded after them
 		m_renderingPipeline.init(pipelineSpec);
 
 		m_colorAttachments.resize(m_colorAttachmentsSpecifications.size());
@@ -93,7 +89,7 @@ namespace MRG::Vulkan
 		std::vector<VkImageView> attachments{};
 
 		for (std::size_t i = 0; i < m_colorAttachmentsSpecifications.size(); ++i) {
-			createImage(data->physicalDevice,
+			createImage(data->allocator,
 			            data->device,
 			            m_specification.width,
 			            m_specification.height,
@@ -102,7 +98,7 @@ namespace MRG::Vulkan
 			            VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT | VK_IMAGE_USAGE_SAMPLED_BIT,
 			            VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT,
 			            m_colorAttachments[i].handle,
-			            m_colorAttachments[i].memoryHandle);
+			            m_colorAttachments[i].allocation);
 
 			transitionImageLayout(data, m_colorAttachments[i].handle, VK_IMAGE_LAYOUT_UNDEFINED, VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL);
 
@@ -135,7 +131,7 @@ namespace MRG::Vulkan
 		MRG_VKVALIDATE(vkCreateSampler(data->device, &samplerInfo, nullptr, &m_sampler), "failed to create texture sampler!")
 
 		if (m_depthAttachmentsSpecification.textureFormat != FramebufferTextureFormat::None) {
-			createImage(data->physicalDevice,
+			createImage(data->allocator,
 			            data->device,
 			            m_specification.width,
 			            m_specification.height,
@@ -144,7 +140,7 @@ namespace MRG::Vulkan
 			            VK_IMAGE_USAGE_DEPTH_STENCIL_ATTACHMENT_BIT,
 			            VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT,
 			            m_depthAttachment.handle,
-			            m_depthAttachment.memoryHandle);
+			            m_depthAttachment.allocation);
 
 			const auto commandBuffer = beginSingleTimeCommand(data);
 
@@ -186,7 +182,7 @@ namespace MRG::Vulkan
 		createInfo.width = m_specification.width;
 		createInfo.height = m_specification.height;
 		createInfo.layers = 1;
-		createInfo.renderPass = m_renderingPipeline.getRenderpass();  // We can use either RP, as we define them as compatible
+		createInfo.renderPass = m_renderingPipeline.getRenderpass();  // We can use either RP, as they are compatible
 		// RP compatibility is defined here:
 		// https://www.khronos.org/registry/vulkan/specs/1.2-extensions/html/vkspec.html#renderpass-compatibility
 
@@ -210,16 +206,15 @@ namespace MRG::Vulkan
 		for (auto& attachment : m_colorAttachments) {
 			vkDestroyImageView(data->device, attachment.imageView, nullptr);
 			vkDestroyImage(data->device, attachment.handle, nullptr);
-			vkFreeMemory(data->device, attachment.memoryHandle, nullptr);
+			data->allocator.free(attachment.allocation);
 		}
 
 		if (m_depthAttachmentsSpecification.textureFormat != FramebufferTextureFormat::None) {
 			vkDestroyImageView(data->device, m_depthAttachment.imageView, nullptr);
 			vkDestroyImage(data->device, m_depthAttachment.handle, nullptr);
-			vkFreeMemory(data->device, m_depthAttachment.memoryHandle, nullptr);
+			data->allocator.free(m_depthAttachment.allocation);
 		}
 
-		m_clearingPipeline.destroy();
 		m_renderingPipeline.destroy();
 
         m_shader->destroy();
@@ -244,13 +239,13 @@ namespace MRG::Vulkan
 		for (auto& attachment : m_colorAttachments) {
 			vkDestroyImageView(data->device, attachment.imageView, nullptr);
 			vkDestroyImage(data->device, attachment.handle, nullptr);
-			vkFreeMemory(data->device, attachment.memoryHandle, nullptr);
+			data->allocator.free(attachment.allocation);
 		}
 
 		if (m_depthAttachmentsSpecification.textureFormat != FramebufferTextureFormat::None) {
 			vkDestroyImageView(data->device, m_depthAttachment.imageView, nullptr);
 			vkDestroyImage(data->device, m_depthAttachment.handle, nullptr);
-			vkFreeMemory(data->device, m_depthAttachment.memoryHandle, nullptr);
+			data->allocator.free(m_depthAttachment.allocation);
 		}
 
 		vkDestroyFramebuffer(data->device, m_handle, nullptr);
@@ -261,7 +256,7 @@ namespace MRG::Vulkan
 
 		for (std::size_t i = 0; i < m_colorAttachmentsSpecifications.size(); ++i) {
 			const auto format = internalToVulkanFormat(m_colorAttachmentsSpecifications[i].textureFormat);
-			createImage(data->physicalDevice,
+			createImage(data->allocator,
 			            data->device,
 			            m_specification.width,
 			            m_specification.height,
@@ -270,7 +265,7 @@ namespace MRG::Vulkan
 			            VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT | VK_IMAGE_USAGE_SAMPLED_BIT,
 			            VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT,
 			            m_colorAttachments[i].handle,
-			            m_colorAttachments[i].memoryHandle);
+			            m_colorAttachments[i].allocation);
 
 			transitionImageLayout(data, m_colorAttachments[i].handle, VK_IMAGE_LAYOUT_UNDEFINED, VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL);
 
@@ -301,7 +296,7 @@ namespace MRG::Vulkan
 		MRG_VKVALIDATE(vkCreateSampler(data->device, &samplerInfo, nullptr, &m_sampler), "failed to create texture sampler!")
 
 		if (m_depthAttachmentsSpecification.textureFormat != FramebufferTextureFormat::None) {
-			createImage(data->physicalDevice,
+			createImage(data->allocator,
 			            data->device,
 			            m_specification.width,
 			            m_specification.height,
@@ -310,7 +305,7 @@ namespace MRG::Vulkan
 			            VK_IMAGE_USAGE_DEPTH_STENCIL_ATTACHMENT_BIT,
 			            VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT,
 			            m_depthAttachment.handle,
-			            m_depthAttachment.memoryHandle);
+			            m_depthAttachment.allocation);
 
 			const auto commandBuffer = beginSingleTimeCommand(data);
 
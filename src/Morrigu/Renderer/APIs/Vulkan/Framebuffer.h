@@ -33,7 +33,6 @@ namespace MRG::Vulkan
 		[[nodiscard]] auto getHandle() const { return m_handle; }
 		[[nodiscard]] auto getColorAttachments() const { return m_colorAttachments; }
 		[[nodiscard]] Pipeline& getRenderingPipeline() { return m_renderingPipeline; }
-		[[nodiscard]] Pipeline& getClearingPipeline() { return m_clearingPipeline; }
 		[[nodiscard]] const auto& getClearValues() const { return m_clearValues; }
 
 		void setClearColor(const glm::vec4& color);
@@ -49,7 +48,7 @@ namespace MRG::Vulkan
 
 		Ref<Shader> m_shader;
 		std::vector<VkClearValue> m_clearValues;
-		Pipeline m_renderingPipeline{}, m_clearingPipeline{};
+		Pipeline m_renderingPipeline{};
 	};
 
 }  // namespace MRG::Vulkan
@@ -25,45 +25,34 @@ namespace MRG::Vulkan
 		return details;
 	}
 
-	[[nodiscard]] uint32_t findMemoryType(VkPhysicalDevice physicalDevice, uint32_t typeFilter, VkMemoryPropertyFlags properties)
-	{
-		VkPhysicalDeviceMemoryProperties memProperties;
-		vkGetPhysicalDeviceMemoryProperties(physicalDevice, &memProperties);
-
-		for (uint32_t i = 0; i < memProperties.memoryTypeCount; ++i) {
-			if (((typeFilter & MRG_BIT(i)) != 0) && (memProperties.memoryTypes[i].propertyFlags & properties) == properties) {
-				return i;
-			}
-		}
-		throw std::runtime_error("failed to find suitable memory type!");
-	}
-
 	void createBuffer(VkDevice device,
-	                  VkPhysicalDevice physicalDevice,
+	                  MemoryAllocator& allocator,
 	                  VkDeviceSize size,
 	                  VkBufferUsageFlags usage,
 	                  VkMemoryPropertyFlags properties,
-	                  Buffer& buffer)
+	                  Buffer& buffer,
+	                  const std::vector<uint32_t>& sharingQueueFamilies)
 	{
 		VkBufferCreateInfo bufferInfo{};
 		bufferInfo.sType = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO;
 		bufferInfo.size = size;
 		bufferInfo.usage = usage;
-		bufferInfo.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
+		if (sharingQueueFamilies.size() > 1) {
+			bufferInfo.sharingMode = VK_SHARING_MODE_CONCURRENT;
+			bufferInfo.queueFamilyIndexCount = static_cast<uint32_t>(sharingQueueFamilies.size());
+			bufferInfo.pQueueFamilyIndices = sharingQueueFamilies.data();
+		} else {
+			bufferInfo.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
+		}
 
 		MRG_VKVALIDATE(vkCreateBuffer(device, &bufferInfo, nullptr, &buffer.handle), "failed to create buffer!")
 
 		VkMemoryRequirements memRequirements;
 		vkGetBufferMemoryRequirements(device, buffer.handle, &memRequirements);
 
-		VkMemoryAllocateInfo allocInfo{};
-		allocInfo.sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO;
-		allocInfo.allocationSize = memRequirements.size;
-		allocInfo.memoryTypeIndex = findMemoryType(physicalDevice, memRequirements.memoryTypeBits, properties);
-
-		MRG_VKVALIDATE(vkAllocateMemory(device, &allocInfo, nullptr, &buffer.memoryHandle), "failed to allocate buffer memory")
+		buffer.allocation = allocator.allocate(memRequirements, properties, true);
 
-		vkBindBufferMemory(device, buffer.handle, buffer.memoryHandle, 0);
+		vkBindBufferMemory(device, buffer.handle, buffer.allocation.memoryHandle, buffer.allocation.offset);
 	}
 
 	[[nodiscard]] VkCommandBuffer beginSingleTimeCommand(const MRG::Vulkan::WindowProperties* data)
@@ -101,18 +90,7 @@ namespace MRG::Vulkan
 		vkFreeCommandBuffers(data->device, data->commandPool, 1, &commandBuffer);
 	}
 
-	void copyBuffer(const MRG::Vulkan::WindowProperties* data, MRG::Vulkan::Buffer src, MRG::Vulkan::Buffer dst, VkDeviceSize size)
-	{
-		const auto commandBuffer = beginSingleTimeCommand(data);
-
-		VkBufferCopy copyRegion{};
-		copyRegion.size = size;
-		vkCmdCopyBuffer(commandBuffer, src.handle, dst.handle, 1, &copyRegion);
-
-		endSingleTimeCommand(data, commandBuffer);
-	}
-
-	void createImage(VkPhysicalDevice physicalDevice,
+	void createImage(MemoryAllocator& allocator,
 	                 VkDevice device,
 	                 uint32_t width,
 	                 uint32_t height,
@@ -121,7 +99,8 @@ namespace MRG::Vulkan
 	                 VkImageUsageFlags usage,
 	                 VkMemoryPropertyFlags properties,
 	                 VkImage& image,
-	                 VkDeviceMemory& imageMemory)
+	                 Allocation& imageAllocation,
+	                 const std::vector<uint32_t>& sharingQueueFamilies)
 	{
 		VkImageCreateInfo imageInfo{};
 		imageInfo.sType = VK_STRUCTURE_TYPE_IMAGE_CREATE_INFO;
@@ -135,7 +114,13 @@ namespace MRG::Vulkan
 		imageInfo.tiling = tiling;
 		imageInfo.initialLayout = VK_IMAGE_LAYOUT_UNDEFINED;
 		imageInfo.usage = usage;
-		imageInfo.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
+		if (sharingQueueFamilies.size() > 1) {
+			imageInfo.sharingMode = VK_SHARING_MODE_CONCURRENT;
+			imageInfo.queueFamilyIndexCount = static_cast<uint32_t>(sharingQueueFamilies.size());
+			imageInfo.pQueueFamilyIndices = sharingQueueFamilies.data();
+		} else {
+			imageInfo.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
+		}
 		imageInfo.samples = VK_SAMPLE_COUNT_1_BIT;
 
 		MRG_VKVALIDATE(vkCreateImage(device, &imageInfo, nullptr, &image), "failed to create image!")
@@ -143,14 +128,9 @@ namespace MRG::Vulkan
 		VkMemoryRequirements memRequirements{};
 		vkGetImageMemoryRequirements(device, image, &memRequirements);
 
-		VkMemoryAllocateInfo allocInfo{};
-		allocInfo.sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO;
-		allocInfo.allocationSize = memRequirements.size;
-		allocInfo.memoryTypeIndex = findMemoryType(physicalDevice, memRequirements.memoryTypeBits, properties);
-
-		MRG_VKVALIDATE(vkAllocateMemory(device, &allocInfo, nullptr, &imageMemory), "failed to allocate image memory!")
+		imageAllocation = allocator.allocate(memRequirements, properties, tiling == VK_IMAGE_TILING_LINEAR);
 
-		vkBindImageMemory(device, image, imageMemory, 0);
+		vkBindImageMemory(device, image, imageAllocation.memoryHandle, imageAllocation.offset);
 	}
 
 	void transitionImageLayout(const MRG::Vulkan::WindowProperties* data, VkImage image, VkImageLayout oldLayout, VkImageLayout newLayout)
@@ -238,27 +218,6 @@ namespace MRG::Vulkan
 		vkCmdPipelineBarrier(commandBuffer, sourceStage, destinationStage, 0, 0, nullptr, 0, nullptr, 1, &barrier);
 	}
 
-	void copyBufferToImage(const MRG::Vulkan::WindowProperties* data, VkBuffer buffer, VkImage image, uint32_t width, uint32_t height)
-	{
-		const auto commandBuffer = beginSingleTimeCommand(data);
-
-		VkBufferImageCopy region{};
-		region.bufferOffset = 0;
-		region.bufferRowLength = 0;
-		region.bufferImageHeight = 0;
-		region.imageSubresource.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
-		region.imageSubresource.mipLevel = 0;
-		region.imageSubresource.baseArrayLayer = 0;
-		region.imageSubresource.layerCount = 1;
-
-		region.imageOffset = {0, 0, 0};
-		region.imageExtent = {width, height, 1};
-
-		vkCmdCopyBufferToImage(commandBuffer, buffer, image, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, 1, &region);
-
-		endSingleTimeCommand(data, commandBuffer);
-	}
-
 	[[nodiscard]] VkImageView createImageView(VkDevice device, VkImage image, VkFormat format, VkImageAspectFlags aspectFlags)
 	{
 		VkImageViewCreateInfo viewInfo{};
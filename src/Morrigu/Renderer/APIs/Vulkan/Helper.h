@@ -18,6 +18,8 @@ namespace MRG::Vulkan
 	{
 		std::optional<uint32_t> graphicsFamily;
 		std::optional<uint32_t> presentFamily;
+		// Only set when the device exposes a queue family without graphics support, usually backed by a DMA engine
+		std::optional<uint32_t> transferFamily;
 
 		[[nodiscard]] bool isComplete() const { return graphicsFamily.has_value() && presentFamily.has_value(); }
 	};
@@ -31,19 +33,18 @@ namespace MRG::Vulkan
 
 	[[nodiscard]] SwapChainSupportDetails querySwapChainSupport(VkPhysicalDevice device, VkSurfaceKHR surface);
 
-	[[nodiscard]] uint32_t findMemoryType(VkPhysicalDevice physicalDevice, uint32_t typeFilter, VkMemoryPropertyFlags properties);
 	void createBuffer(VkDevice device,
-	                  VkPhysicalDevice physicalDevice,
+	                  MemoryAllocator& allocator,
 	                  VkDeviceSize size,
 	                  VkBufferUsageFlags usage,
 	                  VkMemoryPropertyFlags properties,
-	                  Buffer& buffer);
+	                  Buffer& buffer,
+	                  const std::vector<uint32_t>& sharingQueueFamilies = {});
 
 	[[nodiscard]] VkCommandBuffer beginSingleTimeCommand(const MRG::Vulkan::WindowProperties* data);
 	void endSingleTimeCommand(const MRG::Vulkan::WindowProperties* data, VkCommandBuffer commandBuffer);
-	void copyBuffer(const MRG::Vulkan::WindowProperties* data, MRG::Vulkan::Buffer src, MRG::Vulkan::Buffer dst, VkDeviceSize size);
 
-	void createImage(VkPhysicalDevice physicalDevice,
+	void createImage(MemoryAllocator& allocator,
 	                 VkDevice device,
 	                 uint32_t width,
 	                 uint32_t height,
@@ -52,10 +53,10 @@ namespace MRG::Vulkan
 	                 VkImageUsageFlags usage,
 	                 VkMemoryPropertyFlags properties,
 	                 VkImage& image,
-	                 VkDeviceMemory& imageMemory);
+	                 Allocation& imageAllocation,
+	                 const std::vector<uint32_t>& sharingQueueFamilies = {});
 	void transitionImageLayout(const MRG::Vulkan::WindowProperties* data, VkImage image, VkImageLayout oldLayout, VkImageLayout newLayout);
 	void transitionImageLayoutInline(VkCommandBuffer commandBuffer, VkImage image, VkImageLayout oldLayout, VkImageLayout newLayout);
-	void copyBufferToImage(const MRG::Vulkan::WindowProperties* data, VkBuffer buffer, VkImage image, uint32_t width, uint32_t height);
 
 	[[nodiscard]] VkImageView createImageView(VkDevice device, VkImage image, VkFormat format, VkImageAspectFlags aspectFlags);
 }  // namespace MRG::Vulkan
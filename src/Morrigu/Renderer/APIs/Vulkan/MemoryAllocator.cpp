@@ -0,0 +1,252 @@
+#include "MemoryAllocator.h"
+
+#include "Debug/Instrumentor.h"
+#include "Renderer/APIs/Vulkan/Helper.h"
+
+#include <algorithm>
+
+namespace
+{
+	[[nodiscard]] VkDeviceSize roundUpToPowerOfTwo(VkDeviceSize size)
+	{
+		VkDeviceSize result = 1;
+		while (result < size) { result <<= 1; }
+		return result;
+	}
+
+	// Order of the nodes of the given size, which must be a power of two at least as large as the minimal node size
+	[[nodiscard]] uint32_t getOrder(VkDeviceSize nodeSize)
+	{
+		uint32_t order = 0;
+		while ((MRG::Vulkan::MemoryAllocator::minNodeSize << order) < nodeSize) { ++order; }
+		return order;
+	}
+}  // namespace
+
+namespace MRG::Vulkan
+{
+	void MemoryAllocator::init(VkPhysicalDevice physicalDevice, VkDevice device)
+	{
+		MRG_PROFILE_FUNCTION()
+
+		m_device = device;
+		vkGetPhysicalDeviceMemoryProperties(physicalDevice, &m_memoryProperties);
+
+		m_pools.resize(m_memoryProperties.memoryTypeCount * 2);
+		for (uint32_t i = 0; i < m_memoryProperties.memoryTypeCount; ++i) {
+			const auto& memoryType = m_memoryProperties.memoryTypes[i];
+
+			// Small heaps (like the host visible part of the VRAM) still get a few blocks
+			auto blockSize = maxBlockSize;
+			while (blockSize > minNodeSize && blockSize * 8 > m_memoryProperties.memoryHeaps[memoryType.heapIndex].size) {
+				blockSize >>= 1;
+			}
+
+			for (std::size_t j = 0; j < 2; ++j) {
+				auto& pool = m_pools[i * 2 + j];
+				pool.memoryType = i;
+				pool.blockSize = blockSize;
+				pool.isHostVisible = (memoryType.propertyFlags & VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT) != 0;
+			}
+		}
+	}
+
+	void MemoryAllocator::destroy()
+	{
+		MRG_PROFILE_FUNCTION()
+
+		std::lock_guard lock(m_mutex);
+		if (m_statistics.allocationCount != 0) {
+			MRG_ENGINE_WARN("{} GPU allocations were still alive when the memory allocator was destroyed", m_statistics.allocationCount)
+		}
+
+		for (auto& pool : m_pools) {
+			for (const auto& block : pool.blocks) { vkFreeMemory(m_device, block->memoryHandle, nullptr); }
+			pool.blocks.clear();
+		}
+		m_statistics = {};
+	}
+
+	Allocation MemoryAllocator::allocate(const VkMemoryRequirements& requirements, VkMemoryPropertyFlags properties, bool isLinear)
+	{
+		MRG_PROFILE_FUNCTION()
+
+		const auto memoryType = findMemoryType(requirements.memoryTypeBits, properties);
+		const auto poolIndex = memoryType * 2 + (isLinear ? 0 : 1);
+
+		std::lock_guard lock(m_mutex);
+		auto& pool = m_pools[poolIndex];
+
+		Allocation allocation{};
+		allocation.size = requirements.size;
+
+		// Nodes are aligned on their size, and alignments are always powers of two
+		const auto nodeSize = std::max({roundUpToPowerOfTwo(requirements.size), requirements.alignment, minNodeSize});
+		MemoryBlock* block = nullptr;
+		if (nodeSize > pool.blockSize) {
+			block = &createBlock(poolIndex, requirements.size, true);
+		} else {
+			allocation.order = getOrder(nodeSize);
+			for (const auto& candidate : pool.blocks) {
+				if (!candidate->isDedicated && allocateNode(*candidate, allocation.order, allocation.offset)) {
+					block = candidate.get();
+					break;
+				}
+			}
+
+			if (block == nullptr) {
+				block = &createBlock(poolIndex, pool.blockSize, false);
+				[[maybe_unused]] const auto allocated = allocateNode(*block, allocation.order, allocation.offset);
+				MRG_CORE_ASSERT(allocated, "a new memory block should always have room for a node of its size!")
+			}
+		}
+
+		allocation.memoryHandle = block->memoryHandle;
+		allocation.block = block;
+		if (block->mappedData != nullptr) {
+			allocation.mappedData = static_cast<uint8_t*>(block->mappedData) + allocation.offset;
+		}
+
+		++block->allocationCount;
+		++m_statistics.allocationCount;
+		m_statistics.usedBytes += allocation.size;
+
+		return allocation;
+	}
+
+	void MemoryAllocator::free(Allocation& allocation)
+	{
+		MRG_PROFILE_FUNCTION()
+
+		if (allocation.block == nullptr) {
+			return;
+		}
+
+		std::lock_guard lock(m_mutex);
+		auto& block = *allocation.block;
+
+		--block.allocationCount;
+		--m_statistics.allocationCount;
+		m_statistics.usedBytes -= allocation.size;
+
+		if (block.isDedicated) {
+			destroyBlock(block);
+		} else {
+			freeNode(block, allocation.order, allocation.offset);
+
+			// A single empty block is kept around per pool, so that freeing and reallocating a resource doesn't hit the driver
+			if (block.allocationCount == 0) {
+				const auto& blocks = m_pools[block.poolIndex].blocks;
+				const auto emptyBlockCount = std::count_if(blocks.begin(), blocks.end(), [](const auto& candidate) {
+					return !candidate->isDedicated && candidate->allocationCount == 0;
+				});
+				if (emptyBlockCount > 1) {
+					destroyBlock(block);
+				}
+			}
+		}
+
+		allocation = {};
+	}
+
+	MemoryStatistics MemoryAllocator::getStatistics() const
+	{
+		std::lock_guard lock(m_mutex);
+		return m_statistics;
+	}
+
+	uint32_t MemoryAllocator::findMemoryType(uint32_t typeFilter, VkMemoryPropertyFlags properties) const
+	{
+		for (uint32_t i = 0; i < m_memoryProperties.memoryTypeCount; ++i) {
+			if (((typeFilter & MRG_BIT(i)) != 0) && (m_memoryProperties.memoryTypes[i].propertyFlags & properties) == properties) {
+				return i;
+			}
+		}
+		throw std::runtime_error("failed to find suitable memory type!");
+	}
+
+	MemoryBlock& MemoryAllocator::createBlock(std::size_t poolIndex, VkDeviceSize size, bool isDedicated)
+	{
+		MRG_PROFILE_FUNCTION()
+
+		auto& pool = m_pools[poolIndex];
+		auto block = createScope<MemoryBlock>();
+		block->size = size;
+		block->poolIndex = poolIndex;
+		block->isDedicated = isDedicated;
+
+		VkMemoryAllocateInfo allocInfo{};
+		allocInfo.sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO;
+		allocInfo.allocationSize = size;
+		allocInfo.memoryTypeIndex = pool.memoryType;
+
+		MRG_VKVALIDATE(vkAllocateMemory(m_device, &allocInfo, nullptr, &block->memoryHandle), "failed to allocate memory block!")
+
+		if (pool.isHostVisible) {
+			MRG_VKVALIDATE(vkMapMemory(m_device, block->memoryHandle, 0, VK_WHOLE_SIZE, 0, &block->mappedData),
+			               "failed to map memory block!")
+		}
+
+		if (!isDedicated) {
+			block->freeNodes.resize(getOrder(size) + 1);
+			block->freeNodes.back().insert(0);
+		}
+
+		++m_statistics.blockCount;
+		m_statistics.reservedBytes += size;
+
+		return *pool.blocks.emplace_back(std::move(block));
+	}
+
+	void MemoryAllocator::destroyBlock(MemoryBlock& block)
+	{
+		MRG_PROFILE_FUNCTION()
+
+		vkFreeMemory(m_device, block.memoryHandle, nullptr);
+
+		--m_statistics.blockCount;
+		m_statistics.reservedBytes -= block.size;
+
+		auto& blocks = m_pools[block.poolIndex].blocks;
+		blocks.erase(std::find_if(blocks.begin(), blocks.end(), [&block](const auto& candidate) { return candidate.get() == &block; }));
+	}
+
+	bool MemoryAllocator::allocateNode(MemoryBlock& block, uint32_t order, VkDeviceSize& offset)
+	{
+		auto freeOrder = order;
+		while (freeOrder < block.freeNodes.size() && block.freeNodes[freeOrder].empty()) { ++freeOrder; }
+		if (freeOrder == block.freeNodes.size()) {
+			return false;
+		}
+
+		// Taking the lowest free node keeps the allocations packed at the start of the block
+		offset = *block.freeNodes[freeOrder].begin();
+		block.freeNodes[freeOrder].erase(block.freeNodes[freeOrder].begin());
+
+		// Splits the node until it has the right size, freeing the upper halves
+		while (freeOrder > order) {
+			--freeOrder;
+			block.freeNodes[freeOrder].insert(offset + (minNodeSize << freeOrder));
+		}
+
+		return true;
+	}
+
+	void MemoryAllocator::freeNode(MemoryBlock& block, uint32_t order, VkDeviceSize offset)
+	{
+		// Merges the node with its buddy as long as the buddy is free too
+		while (order + 1 < block.freeNodes.size()) {
+			const auto buddy = offset ^ (minNodeSize << order);
+			const auto it = block.freeNodes[order].find(buddy);
+			if (it == block.freeNodes[order].end()) {
+				break;
+			}
+
+			block.freeNodes[order].erase(it);
+			offset = std::min(offset, buddy);
+			++order;
+		}
+
+		block.freeNodes[order].insert(offset);
+	}
+}  // namespace MRG::Vulkan
@@ -0,0 +1,78 @@
+#ifndef MRG_VULKAN_IMPL_MEMORYALLOCATOR
+#define MRG_VULKAN_IMPL_MEMORYALLOCATOR
+
+#include "Core/Core.h"
+#include "Renderer/APIs/Vulkan/VulkanHPPIncludeHelper.h"
+
+#include <mutex>
+#include <set>
+#include <vector>
+
+namespace MRG::Vulkan
+{
+	struct MemoryBlock
+	{
+		VkDeviceMemory memoryHandle{};
+		VkDeviceSize size = 0;
+		void* mappedData = nullptr;
+		std::size_t poolIndex = 0;
+		// Dedicated blocks hold a single resource too large to be sub-allocated
+		bool isDedicated = false;
+		uint32_t allocationCount = 0;
+		// Offsets of the free nodes of every order, the nodes of order n being (minNodeSize << n) bytes large
+		std::vector<std::set<VkDeviceSize>> freeNodes;
+	};
+
+	struct MemoryStatistics
+	{
+		uint32_t blockCount = 0;  // Number of live vkAllocateMemory allocations
+		uint32_t allocationCount = 0;
+		VkDeviceSize reservedBytes = 0;
+		// As requested by the resources, without the rounding to a power of two of the allocator
+		VkDeviceSize usedBytes = 0;
+	};
+
+	// Sub-allocates resources from a few large VkDeviceMemory blocks, as drivers cap the number of allocations (often to 4096) and each
+	// one is expensive. Blocks are split with a buddy allocator, whose power of two nodes are always aligned on their size. Linear
+	// resources (buffers) and optimal ones (images) never share a block, so bufferImageGranularity never has to be accounted for.
+	// Host visible blocks are mapped once for their whole lifetime, as a VkDeviceMemory can't be mapped twice.
+	class MemoryAllocator
+	{
+	public:
+		void init(VkPhysicalDevice physicalDevice, VkDevice device);
+		void destroy();
+
+		[[nodiscard]] Allocation allocate(const VkMemoryRequirements& requirements, VkMemoryPropertyFlags properties, bool isLinear);
+		void free(Allocation& allocation);
+
+		[[nodiscard]] MemoryStatistics getStatistics() const;
+
+		static constexpr VkDeviceSize maxBlockSize = 64 * 1024 * 1024;
+		static constexpr VkDeviceSize minNodeSize = 256;
+
+	private:
+		struct Pool
+		{
+			uint32_t memoryType = 0;
+			VkDeviceSize blockSize = maxBlockSize;
+			bool isHostVisible = false;
+			std::vector<Scope<MemoryBlock>> blocks;
+		};
+
+		[[nodiscard]] uint32_t findMemoryType(uint32_t typeFilter, VkMemoryPropertyFlags properties) const;
+		MemoryBlock& createBlock(std::size_t poolIndex, VkDeviceSize size, bool isDedicated);
+		void destroyBlock(MemoryBlock& block);
+		[[nodiscard]] static bool allocateNode(MemoryBlock& block, uint32_t order, VkDeviceSize& offset);
+		static void freeNode(MemoryBlock& block, uint32_t order, VkDeviceSize offset);
+
+		VkDevice m_device{};
+		VkPhysicalDeviceMemoryProperties m_memoryProperties{};
+		// Two pools per memory type, the linear one first
+		std::vector<Pool> m_pools;
+
+		mutable std::mutex m_mutex;
+		MemoryStatistics m_statistics;
+	};
+}  // namespace MRG::Vulkan
+
+#endif
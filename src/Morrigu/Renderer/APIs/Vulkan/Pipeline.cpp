@@ -1,5 +1,6 @@
 #include "Pipeline.h"
 
+#include "Debug/Instrumentor.h"
 #include "Renderer/APIs/Vulkan/Helper.h"
 
 #include <Renderer/Renderer2D.h>
@@ -18,15 +19,18 @@ namespace MRG::Vulkan
 
 		const auto data = static_cast<WindowProperties*>(glfwGetWindowUserPointer(MRG::Renderer2D::getGLFWWindow()));
 
-		vkDestroyPipeline(data->device, m_handle, nullptr);
-		vkDestroyRenderPass(data->device, m_renderPass, nullptr);
-		vkDestroyPipelineLayout(data->device, m_layout, nullptr);
+		data->pipelineCache.release(m_cacheEntry);
+		m_cacheEntry = PipelineCache::noEntry;
 
 		m_isDestroyed = true;
 	}
 
 	void Pipeline::init(const PipelineSpec& specification)
 	{
+		MRG_PROFILE_FUNCTION()
+
+		destroy();
+
 		const auto data = static_cast<WindowProperties*>(glfwGetWindowUserPointer(MRG::Renderer2D::getGLFWWindow()));
 
 		auto shaderModule = specification.shader;
@@ -34,6 +38,18 @@ namespace MRG::Vulkan
 			shaderModule = data->textureShader;
 		}
 
+		const auto key = PipelineCache::computeKey(*shaderModule, specification);
+		m_cacheEntry = data->pipelineCache.acquire(key);
+		if (m_cacheEntry != PipelineCache::noEntry) {
+			const auto& objects = data->pipelineCache.getObjects(m_cacheEntry);
+			m_layout = objects.layout;
+			m_renderPass = objects.renderPass;
+			m_clearingRenderPass = objects.clearingRenderPass;
+			m_handle = objects.handle;
+			m_isDestroyed = false;
+			return;
+		}
+
 		VkPipelineLayoutCreateInfo layoutCreateInfo{};
 		layoutCreateInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_LAYOUT_CREATE_INFO;
 
@@ -144,8 +160,10 @@ namespace MRG::Vulkan
 		pipelineInfo.subpass = 0;
 		pipelineInfo.pDynamicState = &dynamicState;
 
-		MRG_VKVALIDATE(vkCreateGraphicsPipelines(data->device, VK_NULL_HANDLE, 1, &pipelineInfo, nullptr, &m_handle),
+		MRG_VKVALIDATE(vkCreateGraphicsPipelines(data->device, data->pipelineCache.getHandle(), 1, &pipelineInfo, nullptr, &m_handle),
 		               "failed to create graphics pipeline!")
+		m_cacheEntry =
+		  data->pipelineCache.insert(key, shaderModule->getCodeHash(), {m_layout, m_renderPass, m_clearingRenderPass, m_handle});
 
 		m_isDestroyed = false;
 	}
@@ -160,10 +178,10 @@ namespace MRG::Vulkan
 		VkAttachmentReference depthAttachmentRef{};
 
 		for (uint32_t i = 0; i < specification.colorFormats.size(); ++i) {
-			VkAttachmentDescription clearingColorAttachment = specification.colorAttachmentDescription;
-			clearingColorAttachment.format = specification.colorFormats[i];
+			VkAttachmentDescription colorAttachment = specification.colorAttachmentDescription;
+			colorAttachment.format = specification.colorFormats[i];
 
-			attachments.emplace_back(clearingColorAttachment);
+			attachments.emplace_back(colorAttachment);
 
 			VkAttachmentReference colorAttachmentRef{};
 			colorAttachmentRef.attachment = i;
@@ -173,10 +191,10 @@ namespace MRG::Vulkan
 		}
 
 		if (hasDepthFormat) {
-			VkAttachmentDescription clearingDepthAttachment = specification.depthAttachmentDescription;
-			clearingDepthAttachment.format = specification.depthFormat;
+			VkAttachmentDescription depthAttachment = specification.depthAttachmentDescription;
+			depthAttachment.format = specification.depthFormat;
 
-			attachments.emplace_back(clearingDepthAttachment);
+			attachments.emplace_back(depthAttachment);
 
 			depthAttachmentRef.attachment = static_cast<uint32_t>(colorAttachmentRefs.size());
 			depthAttachmentRef.layout = VK_IMAGE_LAYOUT_DEPTH_STENCIL_ATTACHMENT_OPTIMAL;
@@ -195,6 +213,13 @@ namespace MRG::Vulkan
 		dependency.dstSubpass = 0;
 		dependency.dstStageMask = VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT;
 		dependency.dstAccessMask = VK_ACCESS_COLOR_ATTACHMENT_WRITE_BIT;
+		if (hasDepthFormat) {
+			// Clearing the depth attachment happens in the early fragment tests, after the depth writes of the previous pass
+			dependency.srcStageMask |= VK_PIPELINE_STAGE_LATE_FRAGMENT_TESTS_BIT;
+			dependency.srcAccessMask |= VK_ACCESS_DEPTH_STENCIL_ATTACHMENT_WRITE_BIT;
+			dependency.dstStageMask |= VK_PIPELINE_STAGE_EARLY_FRAGMENT_TESTS_BIT;
+			dependency.dstAccessMask |= VK_ACCESS_DEPTH_STENCIL_ATTACHMENT_WRITE_BIT;
+		}
 
 		VkRenderPassCreateInfo renderPassCreateInfo{};
 		renderPassCreateInfo.sType = VK_STRUCTURE_TYPE_RENDER_PASS_CREATE_INFO;
@@ -207,6 +232,14 @@ namespace MRG::Vulkan
 
 		MRG_VKVALIDATE(vkCreateRenderPass(data->device, &renderPassCreateInfo, nullptr, &m_renderPass), "failed to create renderpass!")
 
+		// The previous content of the attachments is discarded, so the driver never has to load it
+		for (auto& attachment : attachments) {
+			attachment.loadOp = VK_ATTACHMENT_LOAD_OP_CLEAR;
+			attachment.initialLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+		}
+		MRG_VKVALIDATE(vkCreateRenderPass(data->device, &renderPassCreateInfo, nullptr, &m_clearingRenderPass),
+		               "failed to create clearing renderpass!")
+
 		return colorAttachmentRefs.size();
 	}
 
@@ -4,6 +4,8 @@
 #include "Renderer/APIs/Vulkan/Shader.h"
 #include "Renderer/APIs/Vulkan/VulkanHPPIncludeHelper.h"
 
+#include <string>
+
 namespace MRG::Vulkan
 {
 	struct PipelineSpec
@@ -30,14 +32,18 @@ namespace MRG::Vulkan
 
 		[[nodiscard]] VkPipeline getHandle() const { return m_handle; }
 		[[nodiscard]] VkRenderPass getRenderpass() const { return m_renderPass; }
+		// Compatible with the main render pass, but clears every attachment instead of loading it
+		[[nodiscard]] VkRenderPass getClearingRenderpass() const { return m_clearingRenderPass; }
 		[[nodiscard]] VkPipelineLayout getLayout() const { return m_layout; }
 
 	private:
 		std::size_t initRenderpass(const PipelineSpec& specification);
 
 		VkPipelineLayout m_layout{};
-		VkRenderPass m_renderPass{};
+		VkRenderPass m_renderPass{}, m_clearingRenderPass{};
 		VkPipeline m_handle{};
+		// Identifies the pipeline in the pipeline cache, which owns the Vulkan objects
+		uint64_t m_cacheEntry = 0;
 
 		bool m_isDestroyed = true;
 	};
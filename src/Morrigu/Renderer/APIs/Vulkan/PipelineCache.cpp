@@ -0,0 +1,187 @@
+#include "PipelineCache.h"
+
+#include "Debug/Instrumentor.h"
+#include "Renderer/APIs/Vulkan/Helper.h"
+#include "Renderer/APIs/Vulkan/Pipeline.h"
+
+#include <cstring>
+#include <fstream>
+
+namespace
+{
+	template<typename T>
+	void appendBytes(std::string& key, const T& value)
+	{
+		key.append(reinterpret_cast<const char*>(&value), sizeof(T));
+	}
+
+	template<typename T>
+	void appendBytes(std::string& key, const std::vector<T>& values)
+	{
+		appendBytes(key, values.size());
+		key.append(reinterpret_cast<const char*>(values.data()), values.size() * sizeof(T));
+	}
+}  // namespace
+
+namespace MRG::Vulkan
+{
+	void PipelineCache::init(VkPhysicalDevice physicalDevice, VkDevice device, const char* filePath)
+	{
+		MRG_PROFILE_FUNCTION()
+
+		m_device = device;
+		m_filePath = filePath;
+		vkGetPhysicalDeviceProperties(physicalDevice, &m_deviceProperties);
+
+		const auto initialData = loadCacheData();
+
+		VkPipelineCacheCreateInfo cacheInfo{};
+		cacheInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_CACHE_CREATE_INFO;
+		cacheInfo.initialDataSize = initialData.size();
+		cacheInfo.pInitialData = initialData.data();
+
+		MRG_VKVALIDATE(vkCreatePipelineCache(m_device, &cacheInfo, nullptr, &m_handle), "failed to create pipeline cache!")
+	}
+
+	void PipelineCache::destroy()
+	{
+		MRG_PROFILE_FUNCTION()
+
+		if (!m_entries.empty()) {
+			MRG_ENGINE_WARN("{} pipelines were still alive when the pipeline cache was destroyed", m_entries.size())
+			for (const auto& entry : m_entries) { destroyObjects(entry.second.objects); }
+			m_entries.clear();
+			m_entryIDs.clear();
+		}
+
+		saveCacheData();
+		vkDestroyPipelineCache(m_device, m_handle, nullptr);
+	}
+
+	std::string PipelineCache::computeKey(const Shader& shader, const PipelineSpec& spec)
+	{
+		// Every field is plain data and the attachment descriptions are always value initialized, so comparing bytes is enough
+		std::string key;
+		appendBytes(key, shader.getCodeHash());
+		appendBytes(key, spec.colorFormats);
+		appendBytes(key, spec.depthFormat);
+		appendBytes(key, spec.colorAttachmentDescription);
+		appendBytes(key, spec.depthAttachmentDescription);
+		appendBytes(key, spec.attributeDescriptions);
+		appendBytes(key, spec.bindingDescriptions);
+
+		return key;
+	}
+
+	uint64_t PipelineCache::acquire(const std::string& key)
+	{
+		const auto it = m_entryIDs.find(key);
+		if (it == m_entryIDs.end()) {
+			return noEntry;
+		}
+
+		++m_entries.at(it->second).referenceCount;
+		return it->second;
+	}
+
+	uint64_t PipelineCache::insert(const std::string& key, uint64_t shaderCodeHash, const PipelineObjects& objects)
+	{
+		MRG_CORE_ASSERT(m_entryIDs.find(key) == m_entryIDs.end(), "a pipeline with the same specification already exists!")
+
+		const auto entryID = m_nextEntryID++;
+		m_entries.emplace(entryID, Entry{key, shaderCodeHash, objects, 1, false});
+		m_entryIDs.emplace(key, entryID);
+		return entryID;
+	}
+
+	void PipelineCache::release(uint64_t entryID)
+	{
+		const auto it = m_entries.find(entryID);
+		MRG_CORE_ASSERT(it != m_entries.end(), "released a pipeline unknown to the pipeline cache!")
+
+		if (--it->second.referenceCount == 0) {
+			if (!it->second.isEvicted) {
+				m_entryIDs.erase(it->second.key);
+			}
+			destroyObjects(it->second.objects);
+			m_entries.erase(it);
+		}
+	}
+
+	void PipelineCache::evict(uint64_t shaderCodeHash)
+	{
+		for (auto& [entryID, entry] : m_entries) {
+			if (entry.shaderCodeHash == shaderCodeHash && !entry.isEvicted) {
+				m_entryIDs.erase(entry.key);
+				entry.isEvicted = true;
+			}
+		}
+	}
+
+	std::vector<char> PipelineCache::loadCacheData() const
+	{
+		MRG_PROFILE_FUNCTION()
+
+		std::ifstream file(m_filePath, std::ios::binary);
+		if (!file) {
+			return {};
+		}
+
+		CacheHeader header{};
+		file.read(reinterpret_cast<char*>(&header), sizeof(header));
+		if (!file || header.magic != cacheMagic || header.vendorID != m_deviceProperties.vendorID ||
+		    header.deviceID != m_deviceProperties.deviceID || header.driverVersion != m_deviceProperties.driverVersion ||
+		    memcmp(header.pipelineCacheUUID, m_deviceProperties.pipelineCacheUUID, VK_UUID_SIZE) != 0) {
+			MRG_ENGINE_INFO("Pipeline cache '{}' was created by another device or driver, discarding it", m_filePath)
+			return {};
+		}
+
+		std::vector<char> data(header.dataSize);
+		file.read(data.data(), static_cast<std::streamsize>(data.size()));
+		if (!file) {
+			MRG_ENGINE_WARN("Pipeline cache '{}' is truncated, discarding it", m_filePath)
+			return {};
+		}
+
+		MRG_ENGINE_INFO("Loaded {} bytes of pipeline cache from '{}'", data.size(), m_filePath)
+		return data;
+	}
+
+	void PipelineCache::saveCacheData() const
+	{
+		MRG_PROFILE_FUNCTION()
+
+		std::size_t dataSize = 0;
+		if (vkGetPipelineCacheData(m_device, m_handle, &dataSize, nullptr) != VK_SUCCESS || dataSize == 0) {
+			return;
+		}
+
+		std::vector<char> data(dataSize);
+		if (vkGetPipelineCacheData(m_device, m_handle, &dataSize, data.data()) != VK_SUCCESS) {
+			return;
+		}
+
+		CacheHeader header{};
+		header.magic = cacheMagic;
+		header.vendorID = m_deviceProperties.vendorID;
+		header.deviceID = m_deviceProperties.deviceID;
+		header.driverVersion = m_deviceProperties.driverVersion;
+		memcpy(header.pipelineCacheUUID, m_deviceProperties.pipelineCacheUUID, VK_UUID_SIZE);
+		header.dataSize = dataSize;
+
+		std::ofstream file(m_filePath, std::ios::binary | std::ios::trunc);
+		file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+		file.write(data.data(), static_cast<std::streamsize>(dataSize));
+		if (!file) {
+			MRG_ENGINE_WARN("Failed to save the pipeline cache to '{}'", m_filePath)
+		}
+	}
+
+	void PipelineCache::destroyObjects(const PipelineObjects& objects) const
+	{
+		vkDestroyPipeline(m_device, objects.handle, nullptr);
+		vkDestroyRenderPass(m_device, objects.renderPass, nullptr);
+		vkDestroyRenderPass(m_device, objects.clearingRenderPass, nullptr);
+		vkDestroyPipelineLayout(m_device, objects.layout, nullptr);
+	}
+}  // namespace MRG::Vulkan
@@ -0,0 +1,84 @@
+#ifndef MRG_VULKAN_IMPL_PIPELINECACHE
+#define MRG_VULKAN_IMPL_PIPELINECACHE
+
+#include "Renderer/APIs/Vulkan/VulkanHPPIncludeHelper.h"
+
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace MRG::Vulkan
+{
+	class Shader;
+	struct PipelineSpec;
+
+	struct PipelineObjects
+	{
+		VkPipelineLayout layout{};
+		VkRenderPass renderPass{}, clearingRenderPass{};
+		VkPipeline handle{};
+	};
+
+	// Owns the VkPipelineCache shared by every pipeline creation, loaded from and saved to a file of the working directory so that
+	// shaders are not compiled again on every launch. The file is discarded when it was written by another device or driver.
+	// Pipelines created from identical specifications are also deduplicated, and destroyed once their last user releases them.
+	// Entries are identified by a number rather than by their key, as an evicted entry may outlive a new one with the same key.
+	class PipelineCache
+	{
+	public:
+		void init(VkPhysicalDevice physicalDevice, VkDevice device, const char* filePath);
+		void destroy();
+
+		// The shader is identified by a hash of its SPIR-V code, as its module handles may be reused once it is destroyed
+		[[nodiscard]] static std::string computeKey(const Shader& shader, const PipelineSpec& spec);
+
+		// Returns noEntry when no pipeline matches the key, otherwise the returned entry has to be released once unused
+		[[nodiscard]] uint64_t acquire(const std::string& key);
+		[[nodiscard]] uint64_t insert(const std::string& key, uint64_t shaderCodeHash, const PipelineObjects& objects);
+		void release(uint64_t entryID);
+		[[nodiscard]] const PipelineObjects& getObjects(uint64_t entryID) const { return m_entries.at(entryID).objects; }
+		// The pipelines created from the shader can't be acquired anymore, and are destroyed once their last user releases them
+		void evict(uint64_t shaderCodeHash);
+
+		[[nodiscard]] VkPipelineCache getHandle() const { return m_handle; }
+
+		static constexpr uint64_t noEntry = 0;
+
+	private:
+		struct CacheHeader
+		{
+			uint32_t magic;
+			uint32_t vendorID;
+			uint32_t deviceID;
+			uint32_t driverVersion;
+			uint8_t pipelineCacheUUID[VK_UUID_SIZE];
+			uint64_t dataSize;
+		};
+
+		struct Entry
+		{
+			std::string key;
+			uint64_t shaderCodeHash = 0;
+			PipelineObjects objects;
+			uint32_t referenceCount = 0;
+			bool isEvicted = false;
+		};
+
+		[[nodiscard]] std::vector<char> loadCacheData() const;
+		void saveCacheData() const;
+		void destroyObjects(const PipelineObjects& objects) const;
+
+		static constexpr uint32_t cacheMagic = 0x4d524750;  // "MRGP"
+
+		VkDevice m_device{};
+		VkPipelineCache m_handle{};
+		VkPhysicalDeviceProperties m_deviceProperties{};
+		std::string m_filePath;
+		std::unordered_map<uint64_t, Entry> m_entries;
+		// Only lists the entries that have not been evicted
+		std::unordered_map<std::string, uint64_t> m_entryIDs;
+		uint64_t m_nextEntryID = noEntry + 1;
+	};
+}  // namespace MRG::Vulkan
+
+#endif
@@ -1,12 +1,15 @@
 #include "Renderer2D.h"
 
 #include "Debug/Instrumentor.h"
+#include "Renderer/QuadGeneration.h"
 
 #include <ImGui/bindings/imgui_impl_vulkan.h>
 #include <entt/entt.hpp>
 #include <imgui.h>
 
+#include <algorithm>
 #include <array>
+#include <chrono>
 
 namespace
 {
@@ -55,15 +58,29 @@ namespace
 		return formats[0];
 	}
 
-	[[nodiscard]] VkPresentModeKHR chooseSwapPresentMode(const std::vector<VkPresentModeKHR>& presentModes)
+	[[nodiscard]] VkPresentModeKHR chooseSwapPresentMode(const std::vector<VkPresentModeKHR>& presentModes, MRG::PresentMode requested)
 	{
-		// If possible, prefer triple buffering
-		for (const auto& presentMode : presentModes) {
-			if (presentMode == VK_PRESENT_MODE_MAILBOX_KHR) {
-				return presentMode;
-			}
+		VkPresentModeKHR requestedMode = VK_PRESENT_MODE_FIFO_KHR;
+		switch (requested) {
+		case MRG::PresentMode::FIFO:
+			requestedMode = VK_PRESENT_MODE_FIFO_KHR;
+			break;
+		case MRG::PresentMode::FIFORelaxed:
+			requestedMode = VK_PRESENT_MODE_FIFO_RELAXED_KHR;
+			break;
+		case MRG::PresentMode::Mailbox:
+			requestedMode = VK_PRESENT_MODE_MAILBOX_KHR;
+			break;
+		case MRG::PresentMode::Immediate:
+			requestedMode = VK_PRESENT_MODE_IMMEDIATE_KHR;
+			break;
+		}
+
+		if (std::find(presentModes.begin(), presentModes.end(), requestedMode) != presentModes.end()) {
+			return requestedMode;
 		}
 
+		MRG_ENGINE_WARN("The {} present mode is not supported, falling back to FIFO", MRG::getPresentModeName(requested))
 		// This mode is guaranteed to be present by the specs
 		return VK_PRESENT_MODE_FIFO_KHR;
 	}
@@ -95,19 +112,26 @@ namespace
 	}
 
 	[[nodiscard]] MRG::Vulkan::SwapChain
-	createSwapChain(VkPhysicalDevice physicalDevice, VkSurfaceKHR surface, VkDevice device, MRG::Vulkan::WindowProperties* data)
+	createSwapChain(VkPhysicalDevice physicalDevice,
+	                VkSurfaceKHR surface,
+	                VkDevice device,
+	                MRG::Vulkan::WindowProperties* data,
+	                const MRG::PresentationPolicy& policy,
+	                VkSwapchainKHR oldSwapChain)
 	{
 		VkSwapchainKHR handle{};
 		MRG::Vulkan::SwapChainSupportDetails SwapChainSupport = MRG::Vulkan::querySwapChainSupport(physicalDevice, surface);
 
 		const auto surfaceFormat = chooseSwapFormat(SwapChainSupport.formats);
-		const auto presentMode = chooseSwapPresentMode(SwapChainSupport.presentModes);
+		const auto presentMode = chooseSwapPresentMode(SwapChainSupport.presentModes, policy.presentMode);
 		const auto extent = chooseSwapExtent(SwapChainSupport.capabilities, data);
 
-		auto imageCount = SwapChainSupport.capabilities.minImageCount + 1;
-		if (SwapChainSupport.capabilities.maxImageCount > 0 && imageCount > SwapChainSupport.capabilities.maxImageCount) {
-			imageCount = SwapChainSupport.capabilities.maxImageCount;
-		}
+		// A maximum of 0 means that the surface doesn't have any
+		const auto maxImageCount =
+		  (SwapChainSupport.capabilities.maxImageCount > 0) ? SwapChainSupport.capabilities.maxImageCount : UINT32_MAX;
+		auto imageCount =
+		  (policy.swapChainImageCount != 0) ? policy.swapChainImageCount : SwapChainSupport.capabilities.minImageCount + 1;
+		imageCount = std::clamp(imageCount, SwapChainSupport.capabilities.minImageCount, maxImageCount);
 
 		MRG::Vulkan::QueueFamilyIndices indices = findQueueFamilies(physicalDevice, surface);
 		std::array<uint32_t, 2> queueFamilyIndices = {indices.graphicsFamily.value(), indices.presentFamily.value()};
@@ -136,7 +160,8 @@ namespace
 		createInfo.compositeAlpha = VK_COMPOSITE_ALPHA_OPAQUE_BIT_KHR;
 		createInfo.presentMode = presentMode;
 		createInfo.clipped = VK_TRUE;
-		createInfo.oldSwapchain = VK_NULL_HANDLE;
+		// Lets the driver reuse the resources of the old swap chain, which stays valid for the frames still presenting it
+		createInfo.oldSwapchain = oldSwapChain;
 
 		MRG_VKVALIDATE(vkCreateSwapchainKHR(device, &createInfo, nullptr, &handle), "failed to create swapChain!")
 
@@ -149,7 +174,7 @@ namespace
 		return {handle, minImageCount, imageCount, images, surfaceFormat.format, extent, imageViews, {}, {}};
 	}
 
-	[[nodiscard]] VkDescriptorSetLayout createDescriptorSetLayout(VkDevice device, uint32_t textureSlotCount)
+	[[nodiscard]] VkDescriptorSetLayout createDescriptorSetLayout(VkDevice device, uint32_t textureSlotCount, bool textureTable)
 	{
 		VkDescriptorSetLayout returnLayout;
 
@@ -173,6 +198,20 @@ namespace
 		layoutInfo.bindingCount = static_cast<uint32_t>(bindings.size());
 		layoutInfo.pBindings = bindings.data();
 
+		// The texture table is written while in use, and most of its entries are never written at all
+		std::array<VkDescriptorBindingFlags, 2> bindingFlags = {
+		  0,
+		  VK_DESCRIPTOR_BINDING_PARTIALLY_BOUND_BIT | VK_DESCRIPTOR_BINDING_UPDATE_AFTER_BIND_BIT |
+		    VK_DESCRIPTOR_BINDING_UPDATE_UNUSED_WHILE_PENDING_BIT};
+		VkDescriptorSetLayoutBindingFlagsCreateInfo bindingFlagsInfo{};
+		bindingFlagsInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_BINDING_FLAGS_CREATE_INFO;
+		bindingFlagsInfo.bindingCount = static_cast<uint32_t>(bindingFlags.size());
+		bindingFlagsInfo.pBindingFlags = bindingFlags.data();
+		if (textureTable) {
+			layoutInfo.flags = VK_DESCRIPTOR_SET_LAYOUT_CREATE_UPDATE_AFTER_BIND_POOL_BIT;
+			layoutInfo.pNext = &bindingFlagsInfo;
+		}
+
 		MRG_VKVALIDATE(vkCreateDescriptorSetLayout(device, &layoutInfo, nullptr, &returnLayout), "failed to create descriptor set layout!")
 
 		return returnLayout;
@@ -279,13 +318,13 @@ namespace
 		return renderpass;
 	}
 
-	[[nodiscard]] std::vector<std::array<VkFramebuffer, 3>> createFramebuffers(VkDevice device,
+	[[nodiscard]] std::vector<std::array<VkFramebuffer, 2>> createFramebuffers(VkDevice device,
 	                                                                           const std::vector<VkImageView>& swapChainImagesViews,
 	                                                                           VkImageView depthImageView,
-	                                                                           const std::array<VkRenderPass, 3>& renderPasses,
+	                                                                           const std::array<VkRenderPass, 2>& renderPasses,
 	                                                                           const VkExtent2D swapChainExtent)
 	{
-		std::vector<std::array<VkFramebuffer, 3>> frameBuffers(swapChainImagesViews.size());
+		std::vector<std::array<VkFramebuffer, 2>> frameBuffers(swapChainImagesViews.size());
 
 		for (std::size_t i = 0; i < swapChainImagesViews.size(); ++i) {
 			std::array<VkImageView, 2> attachments = {swapChainImagesViews[i], depthImageView};
@@ -298,16 +337,13 @@ namespace
 			framebufferInfo.height = swapChainExtent.height;
 			framebufferInfo.layers = 1;
 
+			// The main framebuffer is used by both the main and the clearing render passes, as they are compatible
 			framebufferInfo.renderPass = renderPasses[0];
 			MRG_VKVALIDATE(vkCreateFramebuffer(device, &framebufferInfo, nullptr, &frameBuffers[i][0]),
-			               "failed to create clearing framebuffer!")
+			               "failed to create main framebuffer!")
 
 			framebufferInfo.renderPass = renderPasses[1];
 			MRG_VKVALIDATE(vkCreateFramebuffer(device, &framebufferInfo, nullptr, &frameBuffers[i][1]),
-			               "failed to create main framebuffer!")
-
-			framebufferInfo.renderPass = renderPasses[2];
-			MRG_VKVALIDATE(vkCreateFramebuffer(device, &framebufferInfo, nullptr, &frameBuffers[i][2]),
 			               "failed to create ImGui framebuffer!")
 		}
 
@@ -330,19 +366,17 @@ namespace
 		return returnCommandPool;
 	}
 
-	[[nodiscard]] std::vector<std::array<VkCommandBuffer, 3>> allocateCommandBuffers(const MRG::Vulkan::WindowProperties* data)
+	[[nodiscard]] std::vector<VkCommandBuffer> allocateCommandBuffers(const MRG::Vulkan::WindowProperties* data, std::size_t count)
 	{
-		std::vector<std::array<VkCommandBuffer, 3>> commandBuffers(data->swapChain.frameBuffers.size());
+		std::vector<VkCommandBuffer> commandBuffers(count);
 
 		VkCommandBufferAllocateInfo allocInfo{};
 		allocInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO;
 		allocInfo.commandPool = data->commandPool;
 		allocInfo.level = VK_COMMAND_BUFFER_LEVEL_PRIMARY;
-		allocInfo.commandBufferCount = 3;
+		allocInfo.commandBufferCount = static_cast<uint32_t>(count);
 
-		for (auto& commandBuffer : commandBuffers) {
-			MRG_VKVALIDATE(vkAllocateCommandBuffers(data->device, &allocInfo, commandBuffer.data()), "failed to allocate command buffers!")
-		}
+		MRG_VKVALIDATE(vkAllocateCommandBuffers(data->device, &allocInfo, commandBuffers.data()), "failed to allocate command buffers!")
 
 		return commandBuffers;
 	}
@@ -353,7 +387,7 @@ namespace
 
 		const auto depthFormat = findDepthFormat(data->physicalDevice);
 
-		MRG::Vulkan::createImage(data->physicalDevice,
+		MRG::Vulkan::createImage(data->allocator,
 		                         data->device,
 		                         data->swapChain.extent.width,
 		                         data->swapChain.extent.height,
@@ -362,63 +396,40 @@ namespace
 		                         VK_IMAGE_USAGE_DEPTH_STENCIL_ATTACHMENT_BIT,
 		                         VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT,
 		                         depthBuffer.handle,
-		                         depthBuffer.memoryHandle);
+		                         depthBuffer.allocation);
 		depthBuffer.imageView = MRG::Vulkan::createImageView(data->device, depthBuffer.handle, depthFormat, VK_IMAGE_ASPECT_DEPTH_BIT);
 
-		const auto commandBuffer = beginSingleTimeCommand(data);
-
-		VkPipelineStageFlags sourceStage, destinationStage;
-		VkImageMemoryBarrier barrier{};
-		barrier.sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER;
-		barrier.oldLayout = VK_IMAGE_LAYOUT_UNDEFINED;
-		barrier.newLayout = VK_IMAGE_LAYOUT_DEPTH_STENCIL_ATTACHMENT_OPTIMAL;
-		barrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
-		barrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
-		barrier.image = depthBuffer.handle;
-		barrier.subresourceRange.aspectMask = VK_IMAGE_ASPECT_DEPTH_BIT;
-		barrier.subresourceRange.baseMipLevel = 0;
-		barrier.subresourceRange.levelCount = 1;
-		barrier.subresourceRange.baseArrayLayer = 0;
-		barrier.subresourceRange.layerCount = 1;
-		barrier.srcAccessMask = 0;
-		barrier.dstAccessMask = VK_ACCESS_SHADER_READ_BIT;
-
-		sourceStage = VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT;
-		destinationStage = VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT;
-
-		vkCmdPipelineBarrier(commandBuffer, sourceStage, destinationStage, 0, 0, nullptr, 0, nullptr, 1, &barrier);
-
-		endSingleTimeCommand(data, commandBuffer);
-
+		// The layout of the depth buffer is only transitioned in the command buffer of the next frame, see Renderer2D::beginFrame
 		return depthBuffer;
 	}
 
-	[[nodiscard]] std::pair<VkDescriptorPool, std::vector<VkDescriptorSet>> createDescriptorPool(const MRG::Vulkan::WindowProperties* data,
-	                                                                                             uint32_t textureCount)
+	[[nodiscard]] std::pair<VkDescriptorPool, std::vector<VkDescriptorSet>>
+	createDescriptorPool(const MRG::Vulkan::WindowProperties* data, uint32_t textureCount, uint32_t setsPerImage)
 	{
 		VkDescriptorPool descriptorPool;
+		const auto setCount = data->swapChain.imageCount * setsPerImage;
 
 		std::array<VkDescriptorPoolSize, 2> poolSizes{};
 		poolSizes[0].type = VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER;
-		poolSizes[0].descriptorCount = data->swapChain.imageCount * textureCount;
+		poolSizes[0].descriptorCount = setCount * textureCount;
 		poolSizes[1].type = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER;
-		poolSizes[1].descriptorCount = data->swapChain.imageCount;
+		poolSizes[1].descriptorCount = setCount;
 
 		VkDescriptorPoolCreateInfo poolInfo{};
 		poolInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_POOL_CREATE_INFO;
 		poolInfo.poolSizeCount = static_cast<uint32_t>(poolSizes.size());
 		poolInfo.pPoolSizes = poolSizes.data();
-		poolInfo.maxSets = data->swapChain.imageCount;
+		poolInfo.maxSets = setCount;
 
 		MRG_VKVALIDATE(vkCreateDescriptorPool(data->device, &poolInfo, nullptr, &descriptorPool), "failed to create descriptor pool!")
 
-		std::vector<VkDescriptorSet> descriptorSets(data->swapChain.imageCount);
+		std::vector<VkDescriptorSet> descriptorSets(setCount);
 
-		std::vector<VkDescriptorSetLayout> layout(data->swapChain.imageCount, data->descriptorSetLayout);
+		std::vector<VkDescriptorSetLayout> layout(setCount, data->descriptorSetLayout);
 		VkDescriptorSetAllocateInfo allocInfo{};
 		allocInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_ALLOCATE_INFO;
 		allocInfo.descriptorPool = descriptorPool;
-		allocInfo.descriptorSetCount = data->swapChain.imageCount;
+		allocInfo.descriptorSetCount = setCount;
 		allocInfo.pSetLayouts = layout.data();
 
 		MRG_VKVALIDATE(vkAllocateDescriptorSets(data->device, &allocInfo, descriptorSets.data()), "failed to allocate descriptor sets!")
@@ -426,6 +437,23 @@ namespace
 		return {descriptorPool, descriptorSets};
 	}
 
+	void destroySwapChain(MRG::Vulkan::WindowProperties* data, const MRG::Vulkan::SwapChain& swapChain)
+	{
+		vkDestroyImageView(data->device, swapChain.depthBuffer.imageView, nullptr);
+		vkDestroyImage(data->device, swapChain.depthBuffer.handle, nullptr);
+		data->allocator.free(swapChain.depthBuffer.allocation);
+
+		for (const auto& framebuffers : swapChain.frameBuffers) {
+			for (auto framebuffer : framebuffers) { vkDestroyFramebuffer(data->device, framebuffer, nullptr); }
+		}
+
+		// TODO: The renderpasses should be recreated here to handle when/if the swapchain format changes.
+
+		for (auto imageView : swapChain.imageViews) { vkDestroyImageView(data->device, imageView, nullptr); }
+
+		vkDestroySwapchainKHR(data->device, swapChain.handle, nullptr);
+	}
+
 }  // namespace
 
 namespace MRG::Vulkan
@@ -437,19 +465,40 @@ namespace MRG::Vulkan
 		m_data = static_cast<WindowProperties*>(glfwGetWindowUserPointer(MRG::Renderer2D::getGLFWWindow()));
 		m_data->textureShader = createRef<Shader>("engine/shaders/texture");
 
-		m_data->swapChain = createSwapChain(m_data->physicalDevice, m_data->surface, m_data->device, m_data);
+		// Mailbox doesn't tear either, it only stops throttling the frame rate to the refresh rate of the display
+		m_presentationPolicy.presentMode = m_data->VSync ? PresentMode::FIFO : PresentMode::Mailbox;
+		m_presentationPolicy.framesInFlight = static_cast<uint32_t>(m_maxFramesInFlight);
+
+		m_data->swapChain =
+		  createSwapChain(m_data->physicalDevice, m_data->surface, m_data->device, m_data, m_presentationPolicy, VK_NULL_HANDLE);
 
 		m_data->ImGuiRenderPass = createImGuiRenderPass(m_data->physicalDevice, m_data->device, m_data->swapChain.imageFormat);
 
 		m_data->commandPool = createCommandPool(m_data->device, m_data->physicalDevice, m_data->surface);
 
+		const auto threadCount = std::max(std::thread::hardware_concurrency(), 1u);
+		m_threadPool = createScope<ThreadPool>(threadCount - 1);
+		m_recordingWorkers.resize(m_maxFramesInFlight);
+		for (auto& workers : m_recordingWorkers) {
+			workers.resize(m_threadPool->getWorkerCount());
+			for (auto& worker : workers) { worker.commandPool = createCommandPool(m_data->device, m_data->physicalDevice, m_data->surface); }
+		}
+
 		m_data->vertexArray = createRef<VertexArray>();
 
-		const auto vertexBuffer = createRef<VertexBuffer>(static_cast<uint32_t>(maxVertices * sizeof(QuadVertex)));
-		vertexBuffer->layout = QuadVertex::getLayout();
-		m_data->vertexArray->addVertexBuffer(vertexBuffer);
+		m_vertexPages.resize(m_maxFramesInFlight);
+		for (auto& pages : m_vertexPages) {
+			const auto vertexBuffer = createRef<VertexBuffer>(getPageSize());
+			if (m_renderingMode == QuadRenderingMode::Instanced) {
+				vertexBuffer->layout = QuadInstance::getLayout();
+				vertexBuffer->perInstance = true;
+			} else {
+				vertexBuffer->layout = QuadVertex::getLayout();
+			}
+			pages.push_back(vertexBuffer);
+		}
+		m_data->vertexArray->addVertexBuffer(m_vertexPages[0][0]);
 
-		m_qvbBase = new QuadVertex[maxVertices];
 		auto quadIndices = new uint32_t[maxIndices];
 
 		uint32_t offset = 0;
@@ -469,45 +518,28 @@ namespace MRG::Vulkan
 		m_data->vertexArray->setIndexBuffer(indexBuffer);
 		delete[] quadIndices;
 
+		if (m_data->supportsTextureTable) {
+			m_data->descriptorSetLayout = createDescriptorSetLayout(m_data->device, TextureTable::maxTextures, true);
+			m_data->textureTable.init(m_data->device, m_data->descriptorSetLayout);
+		} else {
+			m_data->descriptorSetLayout = createDescriptorSetLayout(m_data->device, maxTextureSlots, false);
+
+			auto [pool, descriptors] = createDescriptorPool(m_data, maxTextureSlots, maxBatchesPerSubmit);
+			m_descriptorPool = pool;
+			m_descriptorSets = descriptors;
+		}
+
+		// Being the first texture created, the white texture always gets the index 0 of the texture table
 		m_whiteTexture = createRef<Texture2D>(1, 1);
 		auto whiteTextureData = 0xffffffff;
 		m_whiteTexture->setData(&whiteTextureData, sizeof(whiteTextureData));
+		// The white texture stands in for the textures still being uploaded, so it has to be ready before any of them
+		m_whiteTexture->waitUntilReady();
 
 		m_textureSlots[0] = m_whiteTexture;
 
-		m_data->descriptorSetLayout = createDescriptorSetLayout(m_data->device, maxTextureSlots);
-
-		auto [pool, descriptors] = createDescriptorPool(m_data, maxTextureSlots);
-		m_descriptorPool = pool;
-		m_descriptorSets = descriptors;
-
 		m_data->pushConstantRanges = populatePushConstantsRanges();
 
-		VkAttachmentDescription clearColorAttachment{};
-		clearColorAttachment.samples = VK_SAMPLE_COUNT_1_BIT;
-		clearColorAttachment.loadOp = VK_ATTACHMENT_LOAD_OP_CLEAR;
-		clearColorAttachment.storeOp = VK_ATTACHMENT_STORE_OP_STORE;
-		clearColorAttachment.stencilLoadOp = VK_ATTACHMENT_LOAD_OP_DONT_CARE;
-		clearColorAttachment.stencilStoreOp = VK_ATTACHMENT_STORE_OP_DONT_CARE;
-		clearColorAttachment.initialLayout = VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL;
-		clearColorAttachment.finalLayout = VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL;
-
-		VkAttachmentDescription clearDepthAttachment{};
-		clearDepthAttachment.samples = VK_SAMPLE_COUNT_1_BIT;
-		clearDepthAttachment.loadOp = VK_ATTACHMENT_LOAD_OP_CLEAR;
-		clearDepthAttachment.storeOp = VK_ATTACHMENT_STORE_OP_STORE;
-		clearDepthAttachment.stencilLoadOp = VK_ATTACHMENT_LOAD_OP_DONT_CARE;
-		clearDepthAttachment.stencilStoreOp = VK_ATTACHMENT_STORE_OP_DONT_CARE;
-		clearDepthAttachment.initialLayout = VK_IMAGE_LAYOUT_DEPTH_STENCIL_ATTACHMENT_OPTIMAL;
-		clearDepthAttachment.finalLayout = VK_IMAGE_LAYOUT_DEPTH_STENCIL_ATTACHMENT_OPTIMAL;
-
-		PipelineSpec clearSpec = {m_data->textureShader,
-		                          {m_data->swapChain.imageFormat},
-		                          findDepthFormat(m_data->physicalDevice),
-		                          clearColorAttachment,
-		                          clearDepthAttachment,
-		                          std::static_pointer_cast<MRG::Vulkan::VertexArray>(m_data->vertexArray)->getAttributeDescriptions(),
-		                          {std::static_pointer_cast<MRG::Vulkan::VertexArray>(m_data->vertexArray)->getBindingDescription()}};
 		VkAttachmentDescription renderingColorAttachment{};
 		renderingColorAttachment.samples = VK_SAMPLE_COUNT_1_BIT;
 		renderingColorAttachment.loadOp = VK_ATTACHMENT_LOAD_OP_LOAD;
@@ -533,7 +565,6 @@ namespace MRG::Vulkan
 		                              renderingDepthAttachment,
 		                              std::static_pointer_cast<MRG::Vulkan::VertexArray>(m_data->vertexArray)->getAttributeDescriptions(),
 		                              {std::static_pointer_cast<MRG::Vulkan::VertexArray>(m_data->vertexArray)->getBindingDescription()}};
-		m_data->clearingPipeline.init(clearSpec);
 		m_data->renderingPipeline.init(renderingSpec);
 
 		m_data->swapChain.depthBuffer = createDepthBuffer(m_data);
@@ -542,14 +573,15 @@ namespace MRG::Vulkan
 		  createFramebuffers(m_data->device,
 		                     m_data->swapChain.imageViews,
 		                     m_data->swapChain.depthBuffer.imageView,
-		                     {m_data->clearingPipeline.getRenderpass(), m_data->renderingPipeline.getRenderpass(), m_data->ImGuiRenderPass},
+		                     {m_data->renderingPipeline.getRenderpass(), m_data->ImGuiRenderPass},
 		                     m_data->swapChain.extent);
 
-		m_data->commandBuffers = allocateCommandBuffers(m_data);
+		m_data->commandBuffers = allocateCommandBuffers(m_data, m_maxFramesInFlight);
 
 		m_imageAvailableSemaphores.resize(m_maxFramesInFlight);
 		m_inFlightFences.resize(m_maxFramesInFlight);
 		m_imagesInFlight.resize(m_data->swapChain.imageCount, VK_NULL_HANDLE);
+		m_inFlightInputTimes.resize(m_maxFramesInFlight);
 
 		VkSemaphoreCreateInfo semaphoreInfo{};
 		semaphoreInfo.sType = VK_STRUCTURE_TYPE_SEMAPHORE_CREATE_INFO;
@@ -563,6 +595,9 @@ namespace MRG::Vulkan
 			               "failed to create semaphores for a frame!")
 			MRG_VKVALIDATE(vkCreateFence(m_data->device, &fenceInfo, nullptr, &m_inFlightFences[i]), "failed to create fences for a frame!")
 		}
+		createRenderFinishedSemaphores();
+
+		createTimestampPools();
 	}
 
 	void Renderer2D::shutdown()
@@ -575,16 +610,23 @@ namespace MRG::Vulkan
 			vkDestroySemaphore(m_data->device, m_imageAvailableSemaphores[i], nullptr);
 			vkDestroyFence(m_data->device, m_inFlightFences[i], nullptr);
 		}
+		for (const auto semaphore : m_renderFinishedSemaphores) { vkDestroySemaphore(m_data->device, semaphore, nullptr); }
+		m_renderFinishedSemaphores.clear();
+		for (const auto& pool : m_timestampPools) { vkDestroyQueryPool(m_data->device, pool, nullptr); }
+		m_timestampPools.clear();
 
 		cleanupSwapChain();
 
-		m_data->clearingPipeline.destroy();
 		m_data->renderingPipeline.destroy();
 		vkDestroyRenderPass(m_data->device, m_data->ImGuiRenderPass, nullptr);
 
 		vkDestroyDescriptorSetLayout(m_data->device, m_data->descriptorSetLayout, nullptr);
 
 		m_data->vertexArray->destroy();
+		for (const auto& pages : m_vertexPages) {
+			for (const auto& page : pages) { page->destroy(); }
+		}
+		m_vertexPages.clear();
 		m_data->textureShader->destroy();
 
 		m_whiteTexture->destroy();
@@ -594,13 +636,24 @@ namespace MRG::Vulkan
 			}
 		}
 
+		m_data->textureTable.destroy();
+
 		if (m_renderTarget != nullptr) {
 			m_renderTarget->destroy();
 		}
 
 		vkDestroyCommandPool(m_data->device, m_data->commandPool, nullptr);
 
-		delete[] m_qvbBase;
+		for (const auto& workers : m_recordingWorkers) {
+			for (const auto& worker : workers) { vkDestroyCommandPool(m_data->device, worker.commandPool, nullptr); }
+		}
+		m_recordingWorkers.clear();
+		m_threadPool.reset();
+
+		m_qvbBase = nullptr;
+		m_qvbPtr = nullptr;
+		m_qibBase = nullptr;
+		m_qibPtr = nullptr;
 	}
 
 	void Renderer2D::onWindowResize(uint32_t, uint32_t) { m_shouldRecreateSwapChain = true; }
@@ -609,8 +662,17 @@ namespace MRG::Vulkan
 	{
 		MRG_PROFILE_FUNCTION()
 
-		// wait for preview frames to be finished (only allow m_maxFramesInFlight)
+		// The only wait on the GPU of the frame, for the frame that last used the same resources (only allow m_maxFramesInFlight)
 		vkWaitForFences(m_data->device, 1, &m_inFlightFences[m_data->currentFrame], VK_TRUE, UINT64_MAX);
+		updateLatency();
+		readTimestamps();
+		resetRecordingWorkers();
+		destroyRetiredSwapChains(false);
+		m_data->textureTable.recycleReleasedIndices(m_frameNumber, m_maxFramesInFlight);
+
+		// Every upload recorded since the last frame goes to the GPU in a single submission
+		m_data->uploadContext.update();
+		m_data->uploadContext.flush();
 
 		// Acquire an image from the swapchain
 		const auto result = vkAcquireNextImageKHR(m_data->device,
@@ -630,8 +692,54 @@ namespace MRG::Vulkan
 		}
 		m_imagesInFlight[m_imageIndex] = m_inFlightFences[m_data->currentFrame];
 
-		transitionImageLayout(
-		  m_data, m_data->swapChain.images[m_imageIndex], VK_IMAGE_LAYOUT_UNDEFINED, VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL);
+		m_hasWaitedForImage = false;
+		m_batchIndex = 0;
+		beginFrameCommandBuffer();
+
+		// The image is only acquired once the semaphore waited on at the color attachment output stage is signaled
+		std::array<VkImageMemoryBarrier, 2> barriers{};
+		barriers[0].sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER;
+		barriers[0].oldLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+		barriers[0].newLayout = VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL;
+		barriers[0].srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+		barriers[0].dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+		barriers[0].srcAccessMask = 0;
+		barriers[0].dstAccessMask = VK_ACCESS_COLOR_ATTACHMENT_READ_BIT | VK_ACCESS_COLOR_ATTACHMENT_WRITE_BIT;
+		barriers[0].image = m_data->swapChain.images[m_imageIndex];
+		barriers[0].subresourceRange.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
+		barriers[0].subresourceRange.levelCount = 1;
+		barriers[0].subresourceRange.layerCount = 1;
+		uint32_t barrierCount = 1;
+		VkPipelineStageFlags destinationStage = VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT;
+
+		// A depth buffer created along with the swap chain is transitioned here rather than in a command buffer waited on right away
+		if (!m_isDepthBufferInitialized) {
+			barriers[1].sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER;
+			barriers[1].oldLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+			barriers[1].newLayout = VK_IMAGE_LAYOUT_DEPTH_STENCIL_ATTACHMENT_OPTIMAL;
+			barriers[1].srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+			barriers[1].dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+			barriers[1].srcAccessMask = 0;
+			barriers[1].dstAccessMask = VK_ACCESS_DEPTH_STENCIL_ATTACHMENT_READ_BIT | VK_ACCESS_DEPTH_STENCIL_ATTACHMENT_WRITE_BIT;
+			barriers[1].image = m_data->swapChain.depthBuffer.handle;
+			barriers[1].subresourceRange.aspectMask = VK_IMAGE_ASPECT_DEPTH_BIT;
+			barriers[1].subresourceRange.levelCount = 1;
+			barriers[1].subresourceRange.layerCount = 1;
+			++barrierCount;
+			destinationStage |= VK_PIPELINE_STAGE_EARLY_FRAGMENT_TESTS_BIT;
+			m_isDepthBufferInitialized = true;
+		}
+
+		vkCmdPipelineBarrier(getFrameCommandBuffer(),
+		                     VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT,
+		                     destinationStage,
+		                     0,
+		                     0,
+		                     nullptr,
+		                     0,
+		                     nullptr,
+		                     barrierCount,
+		                     barriers.data());
 
 		return true;
 	}
@@ -640,51 +748,33 @@ namespace MRG::Vulkan
 	{
 		MRG_PROFILE_FUNCTION()
 
+		// Application::run polls the events right before ending the frame, so this is when the input of the next frame is read
+		const auto inputTime = std::chrono::steady_clock::now();
+		const auto commandBuffer = getFrameCommandBuffer();
+
+		recordPendingClear();
+
 		if (m_renderTarget != nullptr) {
 			for (auto& colorAttachment : m_renderTarget->getColorAttachments()) {
-				transitionImageLayout(
-				  m_data, colorAttachment.handle, VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL, VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL);
+				transitionImageLayoutInline(
+				  commandBuffer, colorAttachment.handle, VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL, VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL);
 			}
 		}
 
-		// Execute the command buffer with the current image
-		vkWaitForFences(m_data->device, 1, &m_inFlightFences[m_data->currentFrame], VK_TRUE, UINT64_MAX);
-		vkResetFences(m_data->device, 1, &m_inFlightFences[m_data->currentFrame]);
-
-		VkSemaphore waitSemaphores = m_imageAvailableSemaphores[m_data->currentFrame];
-		VkSemaphore signalSempaphores = m_imageAvailableSemaphores[m_data->currentFrame];
-		VkPipelineStageFlags waitStages = VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT;
-
-		VkCommandBufferBeginInfo beginInfo{};
-		beginInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
-
-		vkResetCommandBuffer(m_data->commandBuffers[m_imageIndex][2], 0);
-
-		MRG_VKVALIDATE(vkBeginCommandBuffer(m_data->commandBuffers[m_imageIndex][2], &beginInfo),
-		               "failed to begin recording command bufer!")
+		writePassBeginTimestamp(commandBuffer, GPUPass::ImGui);
 
 		VkRenderPassBeginInfo renderPassInfo{};
 		renderPassInfo.sType = VK_STRUCTURE_TYPE_RENDER_PASS_BEGIN_INFO;
 		renderPassInfo.renderPass = m_data->ImGuiRenderPass;
-		renderPassInfo.framebuffer = m_data->swapChain.frameBuffers[m_imageIndex][2];
+		renderPassInfo.framebuffer = m_data->swapChain.frameBuffers[m_imageIndex][1];
 		renderPassInfo.renderArea.offset = {0, 0};
 		renderPassInfo.renderArea.extent = m_data->swapChain.extent;
 		renderPassInfo.clearValueCount = 0;
 
-		VkSubmitInfo submitInfo{};
-		submitInfo.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO;
-		submitInfo.waitSemaphoreCount = 1;
-		submitInfo.pWaitSemaphores = &waitSemaphores;
-		submitInfo.pWaitDstStageMask = &waitStages;
-		submitInfo.commandBufferCount = 1;
-		submitInfo.pCommandBuffers = &m_data->commandBuffers[m_imageIndex][2];
-		submitInfo.signalSemaphoreCount = 1;
-		submitInfo.pSignalSemaphores = &signalSempaphores;
-
-		vkCmdBeginRenderPass(m_data->commandBuffers[m_imageIndex][2], &renderPassInfo, VK_SUBPASS_CONTENTS_INLINE);
+		vkCmdBeginRenderPass(commandBuffer, &renderPassInfo, VK_SUBPASS_CONTENTS_INLINE);
 
 		auto& io = ImGui::GetIO();
-		ImGui_ImplVulkan_RenderDrawData(ImGui::GetDrawData(), m_data->commandBuffers[m_imageIndex][2]);
+		ImGui_ImplVulkan_RenderDrawData(ImGui::GetDrawData(), commandBuffer);
 
 		if ((io.ConfigFlags & ImGuiConfigFlags_ViewportsEnable) != 0) {
 			const auto contextBkp = glfwGetCurrentContext();
@@ -693,40 +783,43 @@ namespace MRG::Vulkan
 			glfwMakeContextCurrent(contextBkp);
 		}
 
-		vkCmdEndRenderPass(m_data->commandBuffers[m_imageIndex][2]);
+		vkCmdEndRenderPass(commandBuffer);
 
 		if (m_renderTarget != nullptr) {
 			for (auto& colorAttachment : m_renderTarget->getColorAttachments()) {
-				transitionImageLayoutInline(m_data->commandBuffers[m_imageIndex][2],
-				                            colorAttachment.handle,
-				                            VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL,
-				                            VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL);
+				transitionImageLayoutInline(
+				  commandBuffer, colorAttachment.handle, VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL, VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL);
 			}
 		}
 
-		MRG_VKVALIDATE(vkEndCommandBuffer(m_data->commandBuffers[m_imageIndex][2]), "failed to record command buffer!")
+		writePassEndTimestamp(commandBuffer);
 
-		MRG_VKVALIDATE(vkQueueSubmit(m_data->graphicsQueue.handle, 1, &submitInfo, m_inFlightFences[m_data->currentFrame]),
-		               "failed to submit draw command buffer!")
+		submitFrameCommandBuffer(true);
 
 		VkSwapchainKHR swapChain = m_data->swapChain.handle;
 
 		VkPresentInfoKHR presentInfo{};
 		presentInfo.sType = VK_STRUCTURE_TYPE_PRESENT_INFO_KHR;
 		presentInfo.waitSemaphoreCount = 1;
-		presentInfo.pWaitSemaphores = &waitSemaphores;
+		presentInfo.pWaitSemaphores = &m_renderFinishedSemaphores[m_imageIndex];
 		presentInfo.swapchainCount = 1;
 		presentInfo.pSwapchains = &swapChain;
 		presentInfo.pImageIndices = &m_imageIndex;
 
 		const auto result = vkQueuePresentKHR(m_data->presentQueue.handle, &presentInfo);
 
+		if (m_pendingPresentationPolicy.has_value()) {
+			applyPresentationPolicy();
+		}
+
+		// However many resize events were received during the frame, the swap chain is recreated at most once
 		if (result == VK_ERROR_OUT_OF_DATE_KHR || result == VK_SUBOPTIMAL_KHR || m_shouldRecreateSwapChain) {
 			recreateSwapChain();
-			m_shouldRecreateSwapChain = false;
 		}
 
 		m_data->currentFrame = (m_data->currentFrame + 1) % m_maxFramesInFlight;
+		++m_frameNumber;
+		m_frameInputTime = inputTime;
 
 		return true;
 	}
@@ -738,11 +831,6 @@ namespace MRG::Vulkan
 		setupScene();
 
 		m_modelMatrix.viewProjection = camera.getProjection() * glm::inverse(transform);
-
-		m_quadIndexCount = 0;
-		m_qvbPtr = m_qvbBase;
-
-		m_textureSlotindex = 1;
 	}
 
 	void Renderer2D::beginScene(const EditorCamera& orthoCamera)
@@ -752,178 +840,24 @@ namespace MRG::Vulkan
 		setupScene();
 
 		m_modelMatrix.viewProjection = orthoCamera.getViewProjection();
-
-		m_quadIndexCount = 0;
-		m_qvbPtr = m_qvbBase;
-
-		m_textureSlotindex = 1;
 	}
 
 	void Renderer2D::endScene()
 	{
 		MRG_PROFILE_FUNCTION()
 
-		VkSemaphore waitSemaphores = m_imageAvailableSemaphores[m_data->currentFrame];
-		VkSemaphore signalSemaphores = m_imageAvailableSemaphores[m_data->currentFrame];
-		VkPipelineStageFlags waitStages = VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT;
-
-		VkSubmitInfo submitInfo{};
-		submitInfo.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO;
-		submitInfo.waitSemaphoreCount = 1;
-		submitInfo.pWaitSemaphores = &waitSemaphores;
-		submitInfo.pWaitDstStageMask = &waitStages;
-		submitInfo.commandBufferCount = 1;
-		submitInfo.pCommandBuffers = &m_data->commandBuffers[m_imageIndex][1];
-		submitInfo.signalSemaphoreCount = 1;
-		submitInfo.pSignalSemaphores = &signalSemaphores;
-
-		if (m_quadIndexCount == 0) {
-			vkCmdEndRenderPass(m_data->commandBuffers[m_imageIndex][1]);
-
-			MRG_VKVALIDATE(vkEndCommandBuffer(m_data->commandBuffers[m_imageIndex][1]), "failed to record command buffer!")
-			MRG_VKVALIDATE(vkQueueSubmit(m_data->graphicsQueue.handle, 1, &submitInfo, m_inFlightFences[m_data->currentFrame]),
-			               "failed to submit draw command buffer!")
-			return;
-		}
-
-		auto dataSize = static_cast<uint32_t>((uint8_t*)m_qvbPtr - (uint8_t*)m_qvbBase);
-		m_data->vertexArray->getVertexBuffers()[0]->setData(m_qvbBase, dataSize);
-
-		updateDescriptor();
-
-		vkCmdPushConstants(m_data->commandBuffers[m_imageIndex][1],
-		                   m_data->renderingPipeline.getLayout(),
-		                   VK_SHADER_STAGE_VERTEX_BIT,
-		                   0,
-		                   sizeof(PushConstants),
-		                   &m_modelMatrix);
-
-		vkCmdBindDescriptorSets(m_data->commandBuffers[m_imageIndex][1],
-		                        VK_PIPELINE_BIND_POINT_GRAPHICS,
-		                        m_data->renderingPipeline.getLayout(),
-		                        0,
-		                        1,
-		                        &m_descriptorSets[m_imageIndex],
-		                        0,
-		                        nullptr);
-
-		vkCmdDrawIndexed(m_data->commandBuffers[m_imageIndex][1], m_quadIndexCount, 1, 0, 0, 0);
-		++m_stats.drawCalls;
-
-		vkCmdEndRenderPass(m_data->commandBuffers[m_imageIndex][1]);
+		const auto commandBuffer = getFrameCommandBuffer();
 
-		MRG_VKVALIDATE(vkEndCommandBuffer(m_data->commandBuffers[m_imageIndex][1]), "failed to record command buffer!")
+		// The scene is only submitted with the rest of the frame, so its last vertex page must not be reused before that
+		recordBatch();
+		++m_batchIndex;
 
-		MRG_VKVALIDATE(vkQueueSubmit(m_data->graphicsQueue.handle, 1, &submitInfo, m_inFlightFences[m_data->currentFrame]),
-		               "failed to submit draw command buffer!")
+		vkCmdEndRenderPass(commandBuffer);
+		writePassEndTimestamp(commandBuffer);
 
 		m_sceneInProgress = false;
 	}
 
-	void Renderer2D::drawQuad(const glm::mat4& transform, const glm::vec4& color, uint32_t objectID)
-	{
-		const float texIndex = 0.0f;
-		const float tilingFactor = 1.0f;
-
-		if (m_quadIndexCount >= maxIndices) {
-			flushAndReset();
-		}
-
-		for (std::size_t i = 0; i < m_quadVertexCount; ++i) {
-			m_qvbPtr->position = transform * m_quadVertexPositions[i];
-			m_qvbPtr->color = color;
-			m_qvbPtr->texCoord = m_textureCoordinates[i];
-			m_qvbPtr->texIndex = texIndex;
-			m_qvbPtr->tilingFactor = tilingFactor;
-			m_qvbPtr->objectID = objectID;
-			++m_qvbPtr;
-		}
-
-		objectID = 0x12345678;
-		[[maybe_unused]] const std::vector<uint32_t> temp = {};
-
-		m_quadIndexCount += 6;
-		++m_stats.quadCount;
-	}
-
-	void
-	Renderer2D::drawQuad(const glm::mat4& transform, const Ref<MRG::Texture2D>& texture, float tilingFactor, const glm::vec4& tintColor)
-	{
-		MRG_PROFILE_FUNCTION()
-
-		if (m_quadIndexCount >= maxIndices) {
-			flushAndReset();
-		}
-
-		float texIndex = 0.f;
-		for (uint32_t i = 0; i < m_textureSlotindex; ++i) {
-			if (*m_textureSlots[i] == *texture) {
-				texIndex = static_cast<float>(i);
-				break;
-			}
-		}
-
-		if (texIndex == 0.f) {
-			if (m_textureSlotindex >= maxTextureSlots) {
-				flushAndReset();
-			}
-
-			texIndex = static_cast<float>(m_textureSlotindex);
-			m_textureSlots[m_textureSlotindex] = texture;
-			++m_textureSlotindex;
-		}
-
-		for (std::size_t i = 0; i < m_quadVertexCount; ++i) {
-			m_qvbPtr->position = transform * m_quadVertexPositions[i];
-			m_qvbPtr->color = tintColor;
-			m_qvbPtr->texCoord = m_textureCoordinates[i];
-			m_qvbPtr->texIndex = texIndex;
-			m_qvbPtr->tilingFactor = tilingFactor;
-			++m_qvbPtr;
-		}
-
-		m_quadIndexCount += 6;
-		++m_stats.quadCount;
-	}
-
-	void Renderer2D::drawQuad(const glm::vec3& position, const glm::vec2& size, const glm::vec4& color)
-	{
-		auto transform = glm::translate(glm::mat4{1.f}, position) * glm::scale(glm::mat4{1.f}, {size.x, size.y, 1.f});
-
-		// TODO: This will completely break, but we're not exposing this for now. Fix it before everything breaks please.
-		drawQuad(transform, color, 0);
-	}
-
-	void Renderer2D::drawQuad(
-	  const glm::vec3& position, const glm::vec2& size, const Ref<MRG::Texture2D>& texture, float tilingFactor, const glm::vec4& tintColor)
-	{
-		auto transform = glm::translate(glm::mat4{1.f}, position) * glm::scale(glm::mat4{1.f}, {size.x, size.y, 1.f});
-
-		drawQuad(transform, texture, tilingFactor, tintColor);
-	}
-
-	void Renderer2D::drawRotatedQuad(const glm::vec3& position, const glm::vec2& size, float rotation, const glm::vec4& color)
-	{
-		auto transform = glm::translate(glm::mat4{1.f}, position) * glm::scale(glm::mat4{1.f}, {size.x, size.y, 1.f}) *
-		                 glm::rotate(glm::mat4{1.f}, rotation, {0.f, 0.f, 1.f});
-
-		// TODO: This will completely break, but we're not exposing this for now. Fix it before everything breaks please.
-		drawQuad(transform, color, 0);
-	}
-
-	void Renderer2D::drawRotatedQuad(const glm::vec3& position,
-	                                 const glm::vec2& size,
-	                                 float rotation,
-	                                 const Ref<MRG::Texture2D>& texture,
-	                                 float tilingFactor,
-	                                 const glm::vec4& tintColor)
-	{
-		auto transform = glm::translate(glm::mat4{1.f}, position) * glm::scale(glm::mat4{1.f}, {size.x, size.y, 1.f}) *
-		                 glm::rotate(glm::mat4{1.f}, rotation, {0.f, 0.f, 1.f});
-
-		drawQuad(transform, texture, tilingFactor, tintColor);
-	}
-
 	void Renderer2D::setRenderTarget(Ref<MRG::Framebuffer> renderTarget)
 	{
 		MRG_PROFILE_FUNCTION()
@@ -935,69 +869,20 @@ namespace MRG::Vulkan
 		}
 
 		if (!m_sceneInProgress) {
+			recordPendingClear();
 			m_renderTarget = std::static_pointer_cast<Framebuffer>(renderTarget);
 			m_renderTarget->setClearColor(m_clearColor);
 
 			return;
 		}
 
+		// Both scene passes are recorded in the frame command buffer, one after the other
 		endScene();
 
 		m_renderTarget = std::static_pointer_cast<Framebuffer>(renderTarget);
 		m_renderTarget->setClearColor(m_clearColor);
 
-		vkWaitForFences(m_data->device, 1, &m_inFlightFences[m_data->currentFrame], VK_TRUE, UINT64_MAX);
-		vkResetFences(m_data->device, 1, &m_inFlightFences[m_data->currentFrame]);
-
-		VkCommandBufferBeginInfo beginInfo{};
-		beginInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
-
-		vkResetCommandBuffer(m_data->commandBuffers[m_imageIndex][1], 0);
-
-		MRG_VKVALIDATE(vkBeginCommandBuffer(m_data->commandBuffers[m_imageIndex][1], &beginInfo),
-		               "failed to begin recording command bufer!")
-
-		VkRenderPassBeginInfo renderPassInfo{};
-		renderPassInfo.sType = VK_STRUCTURE_TYPE_RENDER_PASS_BEGIN_INFO;
-		renderPassInfo.renderPass = m_renderTarget->getRenderingPipeline().getRenderpass();
-		renderPassInfo.framebuffer = m_renderTarget->getHandle();
-		renderPassInfo.renderArea.offset = {0, 0};
-		renderPassInfo.renderArea.extent = VkExtent2D{m_renderTarget->getSpecification().width, m_renderTarget->getSpecification().height};
-		renderPassInfo.clearValueCount = 0;
-
-		vkCmdBeginRenderPass(m_data->commandBuffers[m_imageIndex][1], &renderPassInfo, VK_SUBPASS_CONTENTS_INLINE);
-
-		VkViewport viewport{};
-		viewport.x = 0;
-		viewport.y = 0;
-		viewport.width = static_cast<float>(m_renderTarget->getSpecification().width);
-		viewport.height = static_cast<float>(m_renderTarget->getSpecification().height);
-		viewport.minDepth = 0.f;
-		viewport.maxDepth = 1.f;
-		vkCmdSetViewport(m_data->commandBuffers[m_imageIndex][1], 0, 1, &viewport);
-
-		VkRect2D scissor{};
-		scissor.offset = {0, 0};
-		scissor.extent = VkExtent2D{m_renderTarget->getSpecification().width, m_renderTarget->getSpecification().height};
-		vkCmdSetScissor(m_data->commandBuffers[m_imageIndex][1], 0, 1, &scissor);
-
-		vkCmdBindPipeline(
-		  m_data->commandBuffers[m_imageIndex][1], VK_PIPELINE_BIND_POINT_GRAPHICS, m_renderTarget->getRenderingPipeline().getHandle());
-
-		VkBuffer vertexBuffer =
-		  std::static_pointer_cast<MRG::Vulkan::VertexBuffer>(m_data->vertexArray->getVertexBuffers()[0])->getHandle();
-		VkDeviceSize offset = 0;
-		auto indexBuffer = std::static_pointer_cast<MRG::Vulkan::IndexBuffer>(m_data->vertexArray->getIndexBuffer());
-		vkCmdBindVertexBuffers(m_data->commandBuffers[m_imageIndex][1], 0, 1, &vertexBuffer, &offset);
-
-		vkCmdBindIndexBuffer(m_data->commandBuffers[m_imageIndex][1], indexBuffer->getHandle(), 0, VK_INDEX_TYPE_UINT32);
-
-		m_quadIndexCount = 0;
-		m_qvbPtr = m_qvbBase;
-
-		m_textureSlotindex = 1;
-
-		m_sceneInProgress = true;
+		setupScene();
 	}
 
 	void Renderer2D::resetRenderTarget()
@@ -1005,6 +890,7 @@ namespace MRG::Vulkan
 		MRG_PROFILE_FUNCTION()
 
 		if (!m_sceneInProgress) {
+			recordPendingClear();
 			m_renderTarget = nullptr;
 			return;
 		}
@@ -1013,117 +899,250 @@ namespace MRG::Vulkan
 
 		m_renderTarget = nullptr;
 
-		vkWaitForFences(m_data->device, 1, &m_inFlightFences[m_data->currentFrame], VK_TRUE, UINT64_MAX);
-		vkResetFences(m_data->device, 1, &m_inFlightFences[m_data->currentFrame]);
+		setupScene();
+	}
 
-		VkCommandBufferBeginInfo beginInfo{};
-		beginInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
+	void Renderer2D::clear()
+	{
+		MRG_PROFILE_FUNCTION()
 
-		vkResetCommandBuffer(m_data->commandBuffers[m_imageIndex][1], 0);
+		MRG_CORE_ASSERT(!m_sceneInProgress, "Cannot clear the render target while a scene is in progress!")
 
-		MRG_VKVALIDATE(vkBeginCommandBuffer(m_data->commandBuffers[m_imageIndex][1], &beginInfo),
-		               "failed to begin recording command bufer!")
+		// The clear is done by the load operation of the next pass recorded on this target, see beginRenderPass
+		if (m_renderTarget != nullptr) {
+			m_pendingClearValues = m_renderTarget->getClearValues();
+		} else {
+			m_pendingClearValues.resize(2);
+			m_pendingClearValues[0].color = {{m_clearColor.r, m_clearColor.g, m_clearColor.b, m_clearColor.a}};
+			m_pendingClearValues[1].depthStencil = {1.f, 0};
+		}
+	}
 
-		VkRenderPassBeginInfo renderPassInfo{};
-		renderPassInfo.sType = VK_STRUCTURE_TYPE_RENDER_PASS_BEGIN_INFO;
-		renderPassInfo.renderPass = m_data->renderingPipeline.getRenderpass();
-		renderPassInfo.framebuffer = m_data->swapChain.frameBuffers[m_imageIndex][1];
-		renderPassInfo.renderArea.offset = {0, 0};
-		renderPassInfo.renderArea.extent = m_data->swapChain.extent;
-		renderPassInfo.clearValueCount = 0;
+	float Renderer2D::getTextureIndex(const Ref<MRG::Texture2D>& texture)
+	{
+		if (!texture->isReady()) {
+			return 0.f;
+		}
 
-		vkCmdBeginRenderPass(m_data->commandBuffers[m_imageIndex][1], &renderPassInfo, VK_SUBPASS_CONTENTS_INLINE);
+		if (m_data->supportsTextureTable) {
+			return static_cast<float>(std::static_pointer_cast<Vulkan::Texture2D>(texture)->getTableIndex());
+		}
 
-		VkViewport viewport{};
-		viewport.x = 0;
-		viewport.y = 0;
-		viewport.width = static_cast<float>(m_data->swapChain.extent.width);
-		viewport.height = static_cast<float>(m_data->swapChain.extent.height);
-		viewport.minDepth = 0.f;
-		viewport.maxDepth = 1.f;
-		vkCmdSetViewport(m_data->commandBuffers[m_imageIndex][1], 0, 1, &viewport);
+		return Generic2DRenderer::getTextureIndex(texture);
+	}
 
-		VkRect2D scissor{};
-		scissor.offset = {0, 0};
-		scissor.extent = m_data->swapChain.extent;
-		vkCmdSetScissor(m_data->commandBuffers[m_imageIndex][1], 0, 1, &scissor);
+	void Renderer2D::submitQuads(Span<const glm::mat4> transforms,
+	                             const Ref<MRG::Texture2D>& texture,
+	                             float tilingFactor,
+	                             Span<const glm::vec4> colors,
+	                             Span<const uint32_t> objectIDs)
+	{
+		if (transforms.size() >= minParallelQuads && m_threadPool->getWorkerCount() > 1) {
+			submitQuadsInParallel(transforms, texture, tilingFactor, colors, objectIDs);
+			return;
+		}
 
-		vkCmdBindPipeline(m_data->commandBuffers[m_imageIndex][1], VK_PIPELINE_BIND_POINT_GRAPHICS, m_data->renderingPipeline.getHandle());
+		Generic2DRenderer::submitQuads(transforms, texture, tilingFactor, colors, objectIDs);
+	}
 
-		VkBuffer vertexBuffer =
-		  std::static_pointer_cast<MRG::Vulkan::VertexBuffer>(m_data->vertexArray->getVertexBuffers()[0])->getHandle();
-		VkDeviceSize offset = 0;
-		auto indexBuffer = std::static_pointer_cast<MRG::Vulkan::IndexBuffer>(m_data->vertexArray->getIndexBuffer());
-		vkCmdBindVertexBuffers(m_data->commandBuffers[m_imageIndex][1], 0, 1, &vertexBuffer, &offset);
+	void Renderer2D::submitQuadsInParallel(Span<const glm::mat4> transforms,
+	                                       const Ref<MRG::Texture2D>& texture,
+	                                       float tilingFactor,
+	                                       Span<const glm::vec4> colors,
+	                                       Span<const uint32_t> objectIDs)
+	{
+		MRG_PROFILE_FUNCTION()
 
-		vkCmdBindIndexBuffer(m_data->commandBuffers[m_imageIndex][1], indexBuffer->getHandle(), 0, VK_INDEX_TYPE_UINT32);
+		const auto primaryCommandBuffer = getFrameCommandBuffer();
 
-		m_quadIndexCount = 0;
-		m_qvbPtr = m_qvbBase;
+		std::size_t offset = 0;
+		while (offset < transforms.size()) {
+			// A batch is always kept for the quads submitted after these ones
+			if (m_batchIndex + 2 >= maxBatchesPerSubmit) {
+				submitAndRestartScene();
+			}
 
-		m_textureSlotindex = 1;
+			// The quads submitted so far have to be drawn first, and secondary command buffers need a render pass of their own
+			recordBatch();
+			vkCmdEndRenderPass(primaryCommandBuffer);
+
+			const auto firstBatch = m_batchIndex + 1;
+			const auto remainingQuads = transforms.size() - offset;
+			const auto batchCount =
+			  std::min<std::size_t>((remainingQuads + maxQuads - 1) / maxQuads, maxBatchesPerSubmit - 1 - firstBatch);
+
+			// Vertex pages, texture slots and descriptor sets are not thread safe, so they are all prepared beforehand
+			m_textureSlotindex = 1;
+			const auto texIndex = (texture != nullptr) ? getTextureIndex(texture) : 0.f;
+			std::vector<Ref<VertexBuffer>> pages(batchCount);
+			std::vector<VkDescriptorSet> descriptorSets(batchCount, m_data->textureTable.getDescriptorSet());
+			for (std::size_t i = 0; i < batchCount; ++i) {
+				const auto batchIndex = static_cast<uint32_t>(firstBatch + i);
+				pages[i] = getVertexPage(batchIndex);
+				if (!m_data->supportsTextureTable) {
+					descriptorSets[i] = getBatchDescriptorSet(batchIndex);
+					updateDescriptor(descriptorSets[i]);
+				}
+			}
 
-		m_sceneInProgress = true;
+			VkCommandBufferInheritanceInfo inheritanceInfo{};
+			inheritanceInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_INHERITANCE_INFO;
+			inheritanceInfo.renderPass = getSceneRenderPass();
+			inheritanceInfo.subpass = 0;
+			inheritanceInfo.framebuffer = getSceneFramebuffer();
+
+			std::vector<VkCommandBuffer> secondaryCommandBuffers(batchCount);
+			m_threadPool->parallelFor(batchCount, [&](std::size_t job, std::size_t workerIndex) {
+				MRG_PROFILE_SCOPE("Record secondary command buffer")
+
+				const auto jobOffset = offset + job * maxQuads;
+				const auto quadCount = std::min<std::size_t>(maxQuads, transforms.size() - jobOffset);
+				const auto jobObjectIDs = objectIDs.empty() ? nullptr : objectIDs.data() + jobOffset;
+				if (m_renderingMode == QuadRenderingMode::Instanced) {
+					QuadGeneration::generateInstances(transforms.data() + jobOffset,
+					                                  colors.data() + jobOffset,
+					                                  jobObjectIDs,
+					                                  quadCount,
+					                                  texIndex,
+					                                  tilingFactor,
+					                                  static_cast<QuadInstance*>(pages[job]->getMappedData()));
+				} else {
+					QuadGeneration::generateVertices(transforms.data() + jobOffset,
+					                                 colors.data() + jobOffset,
+					                                 jobObjectIDs,
+					                                 quadCount,
+					                                 texIndex,
+					                                 tilingFactor,
+					                                 static_cast<QuadVertex*>(pages[job]->getMappedData()));
+				}
+
+				auto& worker = m_recordingWorkers[m_data->currentFrame][workerIndex];
+				if (worker.usedCommandBuffers == worker.commandBuffers.size()) {
+					VkCommandBufferAllocateInfo allocInfo{};
+					allocInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO;
+					allocInfo.commandPool = worker.commandPool;
+					allocInfo.level = VK_COMMAND_BUFFER_LEVEL_SECONDARY;
+					allocInfo.commandBufferCount = 1;
+
+					VkCommandBuffer newCommandBuffer;
+					MRG_VKVALIDATE(vkAllocateCommandBuffers(m_data->device, &allocInfo, &newCommandBuffer),
+					               "failed to allocate secondary command buffer!")
+					worker.commandBuffers.push_back(newCommandBuffer);
+				}
+				const auto commandBuffer = worker.commandBuffers[worker.usedCommandBuffers++];
+
+				VkCommandBufferBeginInfo beginInfo{};
+				beginInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
+				beginInfo.flags = VK_COMMAND_BUFFER_USAGE_RENDER_PASS_CONTINUE_BIT | VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT;
+				beginInfo.pInheritanceInfo = &inheritanceInfo;
+
+				MRG_VKVALIDATE(vkBeginCommandBuffer(commandBuffer, &beginInfo), "failed to begin recording secondary command buffer!")
+
+				recordSceneState(commandBuffer);
+
+				VkBuffer vertexBuffer = pages[job]->getHandle();
+				VkDeviceSize vertexOffset = 0;
+				vkCmdBindVertexBuffers(commandBuffer, 0, 1, &vertexBuffer, &vertexOffset);
+				vkCmdPushConstants(commandBuffer,
+				                   m_data->renderingPipeline.getLayout(),
+				                   VK_SHADER_STAGE_VERTEX_BIT,
+				                   0,
+				                   sizeof(PushConstants),
+				                   &m_modelMatrix);
+				vkCmdBindDescriptorSets(commandBuffer,
+				                        VK_PIPELINE_BIND_POINT_GRAPHICS,
+				                        m_data->renderingPipeline.getLayout(),
+				                        0,
+				                        1,
+				                        &descriptorSets[job],
+				                        0,
+				                        nullptr);
+
+				if (m_renderingMode == QuadRenderingMode::Instanced) {
+					vkCmdDraw(commandBuffer, 6, static_cast<uint32_t>(quadCount), 0, 0);
+				} else {
+					vkCmdDrawIndexed(commandBuffer, static_cast<uint32_t>(quadCount * 6), 1, 0, 0, 0);
+				}
+
+				MRG_VKVALIDATE(vkEndCommandBuffer(commandBuffer), "failed to record secondary command buffer!")
+				secondaryCommandBuffers[job] = commandBuffer;
+			});
+
+			beginRenderPass(VK_SUBPASS_CONTENTS_SECONDARY_COMMAND_BUFFERS);
+			vkCmdExecuteCommands(
+			  primaryCommandBuffer, static_cast<uint32_t>(secondaryCommandBuffers.size()), secondaryCommandBuffers.data());
+			vkCmdEndRenderPass(primaryCommandBuffer);
+			beginRenderPass(VK_SUBPASS_CONTENTS_INLINE);
+
+			const auto submittedQuads = std::min<std::size_t>(remainingQuads, batchCount * maxQuads);
+			m_stats.quadCount += static_cast<uint32_t>(submittedQuads);
+			m_stats.drawCalls += static_cast<uint32_t>(batchCount);
+			offset += submittedQuads;
+
+			m_batchIndex = static_cast<uint32_t>(firstBatch + batchCount);
+			startBatch();
+		}
 	}
 
-	void Renderer2D::clear()
+	void Renderer2D::setupScene()
 	{
 		MRG_PROFILE_FUNCTION()
 
-		vkWaitForFences(m_data->device, 1, &m_inFlightFences[m_data->currentFrame], VK_TRUE, UINT64_MAX);
-		vkResetFences(m_data->device, 1, &m_inFlightFences[m_data->currentFrame]);
-
-		VkCommandBufferBeginInfo beginInfo{};
-		beginInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
+		if (m_batchIndex >= maxBatchesPerSubmit) {
+			submitRecordedPasses();
+		}
 
-		vkResetCommandBuffer(m_data->commandBuffers[m_imageIndex][0], 0);
+		m_sceneInProgress = true;
 
-		MRG_VKVALIDATE(vkBeginCommandBuffer(m_data->commandBuffers[m_imageIndex][0], &beginInfo),
-		               "failed to begin recording command bufer!")
+		writePassBeginTimestamp(getFrameCommandBuffer(), GPUPass::Scene);
+		beginRenderPass(VK_SUBPASS_CONTENTS_INLINE);
 
-		std::vector<VkClearValue> correctClearValues{};
-		if (m_renderTarget != nullptr) {
-			correctClearValues = m_renderTarget->getClearValues();
-		} else {
-			correctClearValues.resize(2);
-			correctClearValues[0].color = {{m_clearColor.r, m_clearColor.g, m_clearColor.b, m_clearColor.a}};
-			correctClearValues[1].depthStencil = {1.f, 0};
-		}
+		startBatch();
+	}
 
-		const auto hasRenderTarget = m_renderTarget != nullptr;
-		const auto correctRP =
-		  (hasRenderTarget) ? m_renderTarget->getClearingPipeline().getRenderpass() : m_data->clearingPipeline.getRenderpass();
-		const auto correctFB = (hasRenderTarget) ? m_renderTarget->getHandle() : m_data->swapChain.frameBuffers[m_imageIndex][0];
-		const auto correctRenderExtent = (hasRenderTarget)
+	void Renderer2D::beginRenderPass(VkSubpassContents contents)
+	{
+		const auto correctRenderExtent = (m_renderTarget != nullptr)
 		                                   ? VkExtent2D{m_renderTarget->getSpecification().width, m_renderTarget->getSpecification().height}
 		                                   : m_data->swapChain.extent;
-		const auto correctPipeline =
-		  (hasRenderTarget) ? m_renderTarget->getClearingPipeline().getHandle() : m_data->clearingPipeline.getHandle();
 
 		VkRenderPassBeginInfo renderPassInfo{};
 		renderPassInfo.sType = VK_STRUCTURE_TYPE_RENDER_PASS_BEGIN_INFO;
-		renderPassInfo.renderPass = correctRP;
-		renderPassInfo.framebuffer = correctFB;
+		renderPassInfo.renderPass = m_pendingClearValues.empty() ? getSceneRenderPass() : getSceneClearingRenderPass();
+		renderPassInfo.framebuffer = getSceneFramebuffer();
 		renderPassInfo.renderArea.offset = {0, 0};
 		renderPassInfo.renderArea.extent = correctRenderExtent;
-		renderPassInfo.clearValueCount = static_cast<uint32_t>(correctClearValues.size());
-		renderPassInfo.pClearValues = correctClearValues.data();
+		renderPassInfo.clearValueCount = static_cast<uint32_t>(m_pendingClearValues.size());
+		renderPassInfo.pClearValues = m_pendingClearValues.data();
 
-		VkSemaphore waitSemaphores = m_imageAvailableSemaphores[m_data->currentFrame];
-		VkSemaphore signalSemaphores = m_imageAvailableSemaphores[m_data->currentFrame];
-		VkPipelineStageFlags waitStages = VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT;
+		vkCmdBeginRenderPass(getFrameCommandBuffer(), &renderPassInfo, contents);
+		m_pendingClearValues.clear();
 
-		VkSubmitInfo submitInfo{};
-		submitInfo.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO;
-		submitInfo.waitSemaphoreCount = 1;
-		submitInfo.pWaitSemaphores = &waitSemaphores;
-		submitInfo.pWaitDstStageMask = &waitStages;
-		submitInfo.commandBufferCount = 1;
-		submitInfo.pCommandBuffers = &m_data->commandBuffers[m_imageIndex][0];
-		submitInfo.signalSemaphoreCount = 1;
-		submitInfo.pSignalSemaphores = &signalSemaphores;
+		if (contents == VK_SUBPASS_CONTENTS_INLINE) {
+			recordSceneState(getFrameCommandBuffer());
+		}
+	}
+
+	void Renderer2D::recordPendingClear()
+	{
+		if (m_pendingClearValues.empty()) {
+			return;
+		}
+
+		const auto commandBuffer = getFrameCommandBuffer();
+		writePassBeginTimestamp(commandBuffer, GPUPass::Clearing);
 
-		vkCmdBeginRenderPass(m_data->commandBuffers[m_imageIndex][0], &renderPassInfo, VK_SUBPASS_CONTENTS_INLINE);
+		// Nothing is drawn, the load operation of the pass does all the work
+		beginRenderPass(VK_SUBPASS_CONTENTS_SECONDARY_COMMAND_BUFFERS);
+		vkCmdEndRenderPass(commandBuffer);
+
+		writePassEndTimestamp(commandBuffer);
+	}
+
+	void Renderer2D::recordSceneState(VkCommandBuffer commandBuffer) const
+	{
+		const auto correctPipeline =
+		  (m_renderTarget != nullptr) ? m_renderTarget->getRenderingPipeline().getHandle() : m_data->renderingPipeline.getHandle();
 
 		VkViewport viewport{};
 		viewport.x = 0;
@@ -1134,164 +1153,237 @@ namespace MRG::Vulkan
 		  m_renderTarget == nullptr ? static_cast<float>(m_data->swapChain.extent.height) : m_renderTarget->getSpecification().height;
 		viewport.minDepth = 0.f;
 		viewport.maxDepth = 1.f;
-		vkCmdSetViewport(m_data->commandBuffers[m_imageIndex][0], 0, 1, &viewport);
+		vkCmdSetViewport(commandBuffer, 0, 1, &viewport);
 
 		VkRect2D scissor{};
 		scissor.offset = {0, 0};
 		scissor.extent = m_renderTarget == nullptr
 		                   ? m_data->swapChain.extent
 		                   : VkExtent2D{m_renderTarget->getSpecification().width, m_renderTarget->getSpecification().height};
-		vkCmdSetScissor(m_data->commandBuffers[m_imageIndex][0], 0, 1, &scissor);
-
-		vkCmdBindPipeline(m_data->commandBuffers[m_imageIndex][0], VK_PIPELINE_BIND_POINT_GRAPHICS, correctPipeline);
+		vkCmdSetScissor(commandBuffer, 0, 1, &scissor);
 
-		vkCmdEndRenderPass(m_data->commandBuffers[m_imageIndex][0]);
+		vkCmdBindPipeline(commandBuffer, VK_PIPELINE_BIND_POINT_GRAPHICS, correctPipeline);
 
-		MRG_VKVALIDATE(vkEndCommandBuffer(m_data->commandBuffers[m_imageIndex][0]), "failed to record command buffer!")
-
-		MRG_VKVALIDATE(vkQueueSubmit(m_data->graphicsQueue.handle, 1, &submitInfo, m_inFlightFences[m_data->currentFrame]),
-		               "failed to submit draw command buffer!")
+		auto indexBuffer = std::static_pointer_cast<MRG::Vulkan::IndexBuffer>(m_data->vertexArray->getIndexBuffer());
+		// Only blocks on the first frames, until the upload recorded during init is complete
+		indexBuffer->waitUntilReady();
+		vkCmdBindIndexBuffer(commandBuffer, indexBuffer->getHandle(), 0, VK_INDEX_TYPE_UINT32);
 	}
 
-	void Renderer2D::setupScene()
+	void Renderer2D::cleanupSwapChain()
 	{
 		MRG_PROFILE_FUNCTION()
 
-		{
-			MRG_PROFILE_SCOPE("Fences")
-			vkWaitForFences(m_data->device, 1, &m_inFlightFences[m_data->currentFrame], VK_TRUE, UINT64_MAX);
-			vkResetFences(m_data->device, 1, &m_inFlightFences[m_data->currentFrame]);
-		}
+		destroyRetiredSwapChains(true);
+		destroySwapChain(m_data, m_data->swapChain);
 
-		m_sceneInProgress = true;
+		if (m_descriptorPool != VK_NULL_HANDLE) {
+			vkDestroyDescriptorPool(m_data->device, m_descriptorPool, nullptr);
+			m_descriptorPool = VK_NULL_HANDLE;
+		}
+	}
 
-		VkCommandBufferBeginInfo beginInfo{};
-		beginInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
+	void Renderer2D::recreateSwapChain()
+	{
+		MRG_PROFILE_FUNCTION()
 
-		vkResetCommandBuffer(m_data->commandBuffers[m_imageIndex][1], 0);
+		int width = m_data->width, height = m_data->height;
+		while (width == 0 || height == 0) {
+			glfwGetFramebufferSize(MRG::Renderer2D::getGLFWWindow(), &width, &height);
+			glfwWaitEvents();
+		}
 
-		MRG_VKVALIDATE(vkBeginCommandBuffer(m_data->commandBuffers[m_imageIndex][1], &beginInfo),
-		               "failed to begin recording command buffer!")
+		m_data->width = width;
+		m_data->height = height;
+		// Every resize event received until now is handled by this recreation
+		m_shouldRecreateSwapChain = false;
 
-		const auto hasRenderTarget = m_renderTarget != nullptr;
-		const auto correctRP =
-		  (hasRenderTarget) ? m_renderTarget->getRenderingPipeline().getRenderpass() : m_data->renderingPipeline.getRenderpass();
-		const auto correctFB = (hasRenderTarget) ? m_renderTarget->getHandle() : m_data->swapChain.frameBuffers[m_imageIndex][1];
-		const auto correctRenderExtent = (hasRenderTarget)
-		                                   ? VkExtent2D{m_renderTarget->getSpecification().width, m_renderTarget->getSpecification().height}
-		                                   : m_data->swapChain.extent;
-		const auto correctPipeline =
-		  (hasRenderTarget) ? m_renderTarget->getRenderingPipeline().getHandle() : m_data->renderingPipeline.getHandle();
+		MRG_ENGINE_TRACE("Recreating swap chain")
 
-		VkRenderPassBeginInfo renderPassInfo{};
-		renderPassInfo.sType = VK_STRUCTURE_TYPE_RENDER_PASS_BEGIN_INFO;
-		renderPassInfo.renderPass = correctRP;
-		renderPassInfo.framebuffer = correctFB;
-		renderPassInfo.renderArea.offset = {0, 0};
-		renderPassInfo.renderArea.extent = correctRenderExtent;
-		renderPassInfo.clearValueCount = 0;
+		// Frame fences don't cover presentation, so the semaphores can't be destroyed with the rest of the retired resources.
+		// Waiting for the device once in a while keeps them from piling up while the window is being resized.
+		if (m_retiredRenderFinishedSemaphores.size() + m_renderFinishedSemaphores.size() > maxRetiredSemaphores) {
+			vkDeviceWaitIdle(m_data->device);
+			destroyRetiredSwapChains(true);
+		}
 
-		vkCmdBeginRenderPass(m_data->commandBuffers[m_imageIndex][1], &renderPassInfo, VK_SUBPASS_CONTENTS_INLINE);
+		// The frames still in flight keep using the old resources, which are destroyed once they are done instead of waiting for them
+		RetiredSwapChain retiredSwapChain{m_data->swapChain, m_descriptorPool, m_frameNumber};
+		m_descriptorPool = VK_NULL_HANDLE;
+		m_retiredRenderFinishedSemaphores.insert(
+		  m_retiredRenderFinishedSemaphores.end(), m_renderFinishedSemaphores.begin(), m_renderFinishedSemaphores.end());
+		m_renderFinishedSemaphores.clear();
 
-		VkViewport viewport{};
-		viewport.x = 0;
-		viewport.y = 0;
-		viewport.width =
-		  m_renderTarget == nullptr ? static_cast<float>(m_data->swapChain.extent.width) : m_renderTarget->getSpecification().width;
-		viewport.height =
-		  m_renderTarget == nullptr ? static_cast<float>(m_data->swapChain.extent.height) : m_renderTarget->getSpecification().height;
-		viewport.minDepth = 0.f;
-		viewport.maxDepth = 1.f;
-		vkCmdSetViewport(m_data->commandBuffers[m_imageIndex][1], 0, 1, &viewport);
+		m_data->swapChain = createSwapChain(
+		  m_data->physicalDevice, m_data->surface, m_data->device, m_data, m_presentationPolicy, retiredSwapChain.swapChain.handle);
+		m_retiredSwapChains.emplace_back(std::move(retiredSwapChain));
+		MRG_ENGINE_INFO("Vulkan swap chain succesfully recreated")
 
-		VkRect2D scissor{};
-		scissor.offset = {0, 0};
-		scissor.extent = m_renderTarget == nullptr
-		                   ? m_data->swapChain.extent
-		                   : VkExtent2D{m_renderTarget->getSpecification().width, m_renderTarget->getSpecification().height};
-		vkCmdSetScissor(m_data->commandBuffers[m_imageIndex][1], 0, 1, &scissor);
+		m_data->swapChain.depthBuffer = createDepthBuffer(m_data);
+		m_isDepthBufferInitialized = false;
 
-		vkCmdBindPipeline(m_data->commandBuffers[m_imageIndex][1], VK_PIPELINE_BIND_POINT_GRAPHICS, correctPipeline);
+		m_data->swapChain.frameBuffers =
+		  createFramebuffers(m_data->device,
+		                     m_data->swapChain.imageViews,
+		                     m_data->swapChain.depthBuffer.imageView,
+		                     {m_data->renderingPipeline.getRenderpass(), m_data->ImGuiRenderPass},
+		                     m_data->swapChain.extent);
+		MRG_ENGINE_TRACE("Framebuffers successfully created")
 
-		VkBuffer vertexBuffer =
-		  std::static_pointer_cast<MRG::Vulkan::VertexBuffer>(m_data->vertexArray->getVertexBuffers()[0])->getHandle();
-		VkDeviceSize offset = 0;
-		auto indexBuffer = std::static_pointer_cast<MRG::Vulkan::IndexBuffer>(m_data->vertexArray->getIndexBuffer());
-		vkCmdBindVertexBuffers(m_data->commandBuffers[m_imageIndex][1], 0, 1, &vertexBuffer, &offset);
+		if (!m_data->supportsTextureTable) {
+			auto [pool, descriptors] = createDescriptorPool(m_data, maxTextureSlots, maxBatchesPerSubmit);
+			m_descriptorPool = pool;
+			m_descriptorSets = descriptors;
+		}
 
-		vkCmdBindIndexBuffer(m_data->commandBuffers[m_imageIndex][1], indexBuffer->getHandle(), 0, VK_INDEX_TYPE_UINT32);
+		createRenderFinishedSemaphores();
+		m_imagesInFlight.assign(m_data->swapChain.imageCount, VK_NULL_HANDLE);
 	}
 
-	void Renderer2D::cleanupSwapChain()
+	void Renderer2D::destroyRetiredSwapChains(bool destroyAll)
 	{
-		MRG_PROFILE_FUNCTION()
-
-		vkDestroyImageView(m_data->device, m_data->swapChain.depthBuffer.imageView, nullptr);
-		vkDestroyImage(m_data->device, m_data->swapChain.depthBuffer.handle, nullptr);
-		vkFreeMemory(m_data->device, m_data->swapChain.depthBuffer.memoryHandle, nullptr);
+		// Frames complete in submission order, and the fence of the frame m_maxFramesInFlight frames ago has been waited on
+		const auto isUnused = [this, destroyAll](const RetiredSwapChain& retiredSwapChain) {
+			return destroyAll || retiredSwapChain.lastFrame + m_maxFramesInFlight <= m_frameNumber;
+		};
+
+		for (const auto& retiredSwapChain : m_retiredSwapChains) {
+			if (!isUnused(retiredSwapChain)) {
+				continue;
+			}
 
-		for (auto framebuffers : m_data->swapChain.frameBuffers) {
-			for (auto framebuffer : framebuffers) { vkDestroyFramebuffer(m_data->device, framebuffer, nullptr); }
+			destroySwapChain(m_data, retiredSwapChain.swapChain);
+			if (retiredSwapChain.descriptorPool != VK_NULL_HANDLE) {
+				vkDestroyDescriptorPool(m_data->device, retiredSwapChain.descriptorPool, nullptr);
+			}
 		}
 
-		for (auto& commandBuffer : m_data->commandBuffers) {
-			vkFreeCommandBuffers(m_data->device, m_data->commandPool, 3, commandBuffer.data());
+		m_retiredSwapChains.erase(std::remove_if(m_retiredSwapChains.begin(), m_retiredSwapChains.end(), isUnused),
+		                          m_retiredSwapChains.end());
+
+		if (destroyAll) {
+			for (const auto semaphore : m_retiredRenderFinishedSemaphores) { vkDestroySemaphore(m_data->device, semaphore, nullptr); }
+			m_retiredRenderFinishedSemaphores.clear();
 		}
+	}
 
-		// TODO: The renderpasses should be recreated here to handle when/if the swapchain format changes.
+	void Renderer2D::setPresentationPolicy(const PresentationPolicy& policy)
+	{
+		auto pendingPolicy = policy;
+		pendingPolicy.framesInFlight = std::clamp(policy.framesInFlight, 1u, PresentationPolicy::maxFramesInFlight);
+		m_pendingPresentationPolicy = pendingPolicy;
+	}
+
+	void Renderer2D::applyPresentationPolicy()
+	{
+		MRG_PROFILE_FUNCTION()
 
-		for (auto imageView : m_data->swapChain.imageViews) { vkDestroyImageView(m_data->device, imageView, nullptr); }
+		const auto policy = m_pendingPresentationPolicy.value();
+		m_pendingPresentationPolicy.reset();
 
-		vkDestroySwapchainKHR(m_data->device, m_data->swapChain.handle, nullptr);
+		if (policy.framesInFlight != m_maxFramesInFlight) {
+			MRG_ENGINE_TRACE("Changing the number of frames in flight from {} to {}", m_maxFramesInFlight, policy.framesInFlight)
 
-		vkDestroyDescriptorPool(m_data->device, m_descriptorPool, nullptr);
+			// Every per frame resource may be in use, but unlike a resize this only happens when explicitly asked to
+			vkDeviceWaitIdle(m_data->device);
+			updateLatency();
+			destroyRetiredSwapChains(true);
+			resizeFrameResources(policy.framesInFlight);
+		}
+
+		if (policy.presentMode != m_presentationPolicy.presentMode ||
+		    policy.swapChainImageCount != m_presentationPolicy.swapChainImageCount) {
+			m_shouldRecreateSwapChain = true;
+		}
+
+		m_presentationPolicy = policy;
 	}
 
-	void Renderer2D::recreateSwapChain()
+	void Renderer2D::resizeFrameResources(std::size_t framesInFlight)
 	{
 		MRG_PROFILE_FUNCTION()
 
-		int width = m_data->width, height = m_data->height;
-		while (width == 0 || height == 0) {
-			glfwGetFramebufferSize(MRG::Renderer2D::getGLFWWindow(), &width, &height);
-			glfwWaitEvents();
+		for (auto i = framesInFlight; i < m_maxFramesInFlight; ++i) {
+			vkDestroySemaphore(m_data->device, m_imageAvailableSemaphores[i], nullptr);
+			vkDestroyFence(m_data->device, m_inFlightFences[i], nullptr);
+			for (const auto& worker : m_recordingWorkers[i]) { vkDestroyCommandPool(m_data->device, worker.commandPool, nullptr); }
+			for (const auto& page : m_vertexPages[i]) { page->destroy(); }
 		}
+		vkFreeCommandBuffers(m_data->device,
+		                     m_data->commandPool,
+		                     static_cast<uint32_t>(m_data->commandBuffers.size()),
+		                     m_data->commandBuffers.data());
 
-		m_data->width = width;
-		m_data->height = height;
+		const auto previousFramesInFlight = m_maxFramesInFlight;
+		m_maxFramesInFlight = framesInFlight;
+		m_imageAvailableSemaphores.resize(m_maxFramesInFlight);
+		m_inFlightFences.resize(m_maxFramesInFlight);
+		m_recordingWorkers.resize(m_maxFramesInFlight);
+		m_vertexPages.resize(m_maxFramesInFlight);
+		m_inFlightInputTimes.assign(m_maxFramesInFlight, std::nullopt);
 
-		MRG_ENGINE_TRACE("Recreating swap chain")
-		MRG_ENGINE_TRACE("Waiting for device to be idle...")
-		vkDeviceWaitIdle(m_data->device);
+		VkSemaphoreCreateInfo semaphoreInfo{};
+		semaphoreInfo.sType = VK_STRUCTURE_TYPE_SEMAPHORE_CREATE_INFO;
 
-		cleanupSwapChain();
+		VkFenceCreateInfo fenceInfo{};
+		fenceInfo.sType = VK_STRUCTURE_TYPE_FENCE_CREATE_INFO;
+		fenceInfo.flags = VK_FENCE_CREATE_SIGNALED_BIT;
 
-		m_data->swapChain = createSwapChain(m_data->physicalDevice, m_data->surface, m_data->device, m_data);
-		MRG_ENGINE_INFO("Vulkan swap chain succesfully recreated")
+		// The first frame in flight is never removed, so its first page serves as a model for the others
+		const auto& modelPage = m_vertexPages[0].front();
+		for (auto i = previousFramesInFlight; i < m_maxFramesInFlight; ++i) {
+			MRG_VKVALIDATE(vkCreateSemaphore(m_data->device, &semaphoreInfo, nullptr, &m_imageAvailableSemaphores[i]),
+			               "failed to create semaphores for a frame!")
+			MRG_VKVALIDATE(vkCreateFence(m_data->device, &fenceInfo, nullptr, &m_inFlightFences[i]), "failed to create fences for a frame!")
 
-		m_data->swapChain.depthBuffer = createDepthBuffer(m_data);
+			m_recordingWorkers[i].resize(m_threadPool->getWorkerCount());
+			for (auto& worker : m_recordingWorkers[i]) {
+				worker.commandPool = createCommandPool(m_data->device, m_data->physicalDevice, m_data->surface);
+			}
 
-		MRG_ENGINE_INFO("Vulkan graphics pipeline successfully created")
-		m_data->swapChain.frameBuffers =
-		  createFramebuffers(m_data->device,
-		                     m_data->swapChain.imageViews,
-		                     m_data->swapChain.depthBuffer.imageView,
-		                     {m_data->clearingPipeline.getRenderpass(), m_data->renderingPipeline.getRenderpass(), m_data->ImGuiRenderPass},
-		                     m_data->swapChain.extent);
-		MRG_ENGINE_TRACE("Framebuffers successfully created")
+			const auto vertexBuffer = createRef<VertexBuffer>(getPageSize());
+			vertexBuffer->layout = modelPage->layout;
+			vertexBuffer->perInstance = modelPage->perInstance;
+			m_vertexPages[i].push_back(vertexBuffer);
+		}
 
-		auto [pool, descriptors] = createDescriptorPool(m_data, maxTextureSlots);
-		m_descriptorPool = pool;
-		m_descriptorSets = descriptors;
+		m_data->commandBuffers = allocateCommandBuffers(m_data, m_maxFramesInFlight);
 
-		m_data->commandBuffers = allocateCommandBuffers(m_data);
+		if (m_supportsTimestamps) {
+			for (const auto& pool : m_timestampPools) { vkDestroyQueryPool(m_data->device, pool, nullptr); }
+			m_timestampPools.clear();
+			m_timestampPasses.clear();
+			createTimestampPools();
+		}
 
-		if (m_renderTarget != nullptr) {
-			m_renderTarget->invalidate();
+		// The fences the images were waiting on may be gone, and the device being idle, any frame in flight can come next
+		m_imagesInFlight.assign(m_data->swapChain.imageCount, VK_NULL_HANDLE);
+		m_data->currentFrame = 0;
+	}
+
+	void Renderer2D::updateLatency()
+	{
+		// Only the most recent of the frames completed since the last call is reported
+		std::optional<std::chrono::steady_clock::time_point> lastInputTime;
+		for (std::size_t i = 0; i < m_maxFramesInFlight; ++i) {
+			auto& inputTime = m_inFlightInputTimes[i];
+			if (!inputTime.has_value() || vkGetFenceStatus(m_data->device, m_inFlightFences[i]) != VK_SUCCESS) {
+				continue;
+			}
+
+			if (!lastInputTime.has_value() || inputTime.value() > lastInputTime.value()) {
+				lastInputTime = inputTime;
+			}
+			inputTime.reset();
+		}
+
+		if (lastInputTime.has_value()) {
+			const std::chrono::duration<float, std::milli> latency = std::chrono::steady_clock::now() - lastInputTime.value();
+			m_inputToGPUCompletionLatency = latency.count();
 		}
 	}
 
-	void Renderer2D::updateDescriptor()
+	void Renderer2D::updateDescriptor(VkDescriptorSet descriptorSet)
 	{
 		MRG_PROFILE_FUNCTION()
 
@@ -1308,7 +1400,7 @@ namespace MRG::Vulkan
 		std::array<VkWriteDescriptorSet, 1> descriptorWrites{};
 
 		descriptorWrites[0].sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
-		descriptorWrites[0].dstSet = m_descriptorSets[m_imageIndex];
+		descriptorWrites[0].dstSet = descriptorSet;
 		descriptorWrites[0].dstBinding = 1;
 		descriptorWrites[0].dstArrayElement = 0;
 		descriptorWrites[0].descriptorType = VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER;
@@ -1318,74 +1410,287 @@ namespace MRG::Vulkan
 		vkUpdateDescriptorSets(m_data->device, static_cast<uint32_t>(descriptorWrites.size()), descriptorWrites.data(), 0, nullptr);
 	}
 
+	Ref<VertexBuffer> Renderer2D::getVertexPage(uint32_t batchIndex)
+	{
+		auto& pages = m_vertexPages[m_data->currentFrame];
+		while (batchIndex >= pages.size()) {
+			const auto vertexBuffer = createRef<VertexBuffer>(getPageSize());
+			vertexBuffer->layout = pages.front()->layout;
+			vertexBuffer->perInstance = pages.front()->perInstance;
+			pages.push_back(vertexBuffer);
+		}
+
+		return pages[batchIndex];
+	}
+
+	void Renderer2D::startBatch()
+	{
+		const auto page = getVertexPage(m_batchIndex);
+
+		VkBuffer vertexBuffer = page->getHandle();
+		VkDeviceSize offset = 0;
+		vkCmdBindVertexBuffers(getFrameCommandBuffer(), 0, 1, &vertexBuffer, &offset);
+
+		m_quadIndexCount = 0;
+		if (m_renderingMode == QuadRenderingMode::Instanced) {
+			m_qibBase = static_cast<QuadInstance*>(page->getMappedData());
+			m_qibPtr = m_qibBase;
+		} else {
+			m_qvbBase = static_cast<QuadVertex*>(page->getMappedData());
+			m_qvbPtr = m_qvbBase;
+		}
+
+		m_textureSlotindex = 1;
+	}
+
+	void Renderer2D::recordBatch()
+	{
+		MRG_PROFILE_FUNCTION()
+
+		if (m_quadIndexCount == 0) {
+			return;
+		}
+
+		VkDescriptorSet descriptorSet{};
+		if (m_data->supportsTextureTable) {
+			descriptorSet = m_data->textureTable.getDescriptorSet();
+		} else {
+			descriptorSet = getBatchDescriptorSet(m_batchIndex);
+			updateDescriptor(descriptorSet);
+		}
+
+		const auto commandBuffer = getFrameCommandBuffer();
+		vkCmdPushConstants(commandBuffer,
+		                   m_data->renderingPipeline.getLayout(),
+		                   VK_SHADER_STAGE_VERTEX_BIT,
+		                   0,
+		                   sizeof(PushConstants),
+		                   &m_modelMatrix);
+
+		vkCmdBindDescriptorSets(commandBuffer,
+		                        VK_PIPELINE_BIND_POINT_GRAPHICS,
+		                        m_data->renderingPipeline.getLayout(),
+		                        0,
+		                        1,
+		                        &descriptorSet,
+		                        0,
+		                        nullptr);
+
+		if (m_renderingMode == QuadRenderingMode::Instanced) {
+			vkCmdDraw(commandBuffer, 6, m_quadIndexCount / 6, 0, 0);
+		} else {
+			vkCmdDrawIndexed(commandBuffer, m_quadIndexCount, 1, 0, 0, 0);
+		}
+		++m_stats.drawCalls;
+	}
+
 	void Renderer2D::flushAndReset()
 	{
 		MRG_PROFILE_FUNCTION()
 
+		// As long as there are descriptor sets left, keep recording batches in the frame command buffer and submit them all at once.
+		if (m_batchIndex + 1 < maxBatchesPerSubmit) {
+			recordBatch();
+			++m_batchIndex;
+			startBatch();
+			return;
+		}
+
+		submitAndRestartScene();
+	}
+
+	void Renderer2D::submitAndRestartScene()
+	{
+		MRG_PROFILE_FUNCTION()
+
 		endScene();
+		submitRecordedPasses();
+		setupScene();
+	}
 
-		vkWaitForFences(m_data->device, 1, &m_inFlightFences[m_data->currentFrame], VK_TRUE, UINT64_MAX);
-		vkResetFences(m_data->device, 1, &m_inFlightFences[m_data->currentFrame]);
+	void Renderer2D::beginFrameCommandBuffer()
+	{
+		const auto commandBuffer = getFrameCommandBuffer();
 
 		VkCommandBufferBeginInfo beginInfo{};
 		beginInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
+		beginInfo.flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT;
 
-		vkResetCommandBuffer(m_data->commandBuffers[m_imageIndex][1], 0);
+		vkResetCommandBuffer(commandBuffer, 0);
+		MRG_VKVALIDATE(vkBeginCommandBuffer(commandBuffer, &beginInfo), "failed to begin recording command buffer!")
+	}
 
-		MRG_VKVALIDATE(vkBeginCommandBuffer(m_data->commandBuffers[m_imageIndex][1], &beginInfo),
-		               "failed to begin recording command buffer!")
+	void Renderer2D::submitFrameCommandBuffer(bool isLastSubmission)
+	{
+		MRG_PROFILE_FUNCTION()
 
-		const auto hasRenderTarget = m_renderTarget != nullptr;
-		const auto correctRP =
-		  (hasRenderTarget) ? m_renderTarget->getRenderingPipeline().getRenderpass() : m_data->renderingPipeline.getRenderpass();
-		const auto correctFB = (hasRenderTarget) ? m_renderTarget->getHandle() : m_data->swapChain.frameBuffers[m_imageIndex][1];
-		const auto correctRenderExtent = (hasRenderTarget)
-		                                   ? VkExtent2D{m_renderTarget->getSpecification().width, m_renderTarget->getSpecification().height}
-		                                   : m_data->swapChain.extent;
-		const auto correctPipeline =
-		  (hasRenderTarget) ? m_renderTarget->getRenderingPipeline().getHandle() : m_data->renderingPipeline.getHandle();
+		const auto commandBuffer = getFrameCommandBuffer();
+		MRG_VKVALIDATE(vkEndCommandBuffer(commandBuffer), "failed to record command buffer!")
 
-		VkRenderPassBeginInfo renderPassInfo{};
-		renderPassInfo.sType = VK_STRUCTURE_TYPE_RENDER_PASS_BEGIN_INFO;
-		renderPassInfo.renderPass = correctRP;
-		renderPassInfo.framebuffer = correctFB;
-		renderPassInfo.renderArea.offset = {0, 0};
-		renderPassInfo.renderArea.extent = correctRenderExtent;
-		renderPassInfo.clearValueCount = 0;
+		const VkPipelineStageFlags waitStage = VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT;
 
-		vkCmdBeginRenderPass(m_data->commandBuffers[m_imageIndex][1], &renderPassInfo, VK_SUBPASS_CONTENTS_INLINE);
+		VkSubmitInfo submitInfo{};
+		submitInfo.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO;
+		submitInfo.commandBufferCount = 1;
+		submitInfo.pCommandBuffers = &commandBuffer;
+		// The first submission of the frame is the one that writes to the swapchain image first
+		if (!m_hasWaitedForImage) {
+			submitInfo.waitSemaphoreCount = 1;
+			submitInfo.pWaitSemaphores = &m_imageAvailableSemaphores[m_data->currentFrame];
+			submitInfo.pWaitDstStageMask = &waitStage;
+			m_hasWaitedForImage = true;
+		}
+		if (isLastSubmission) {
+			submitInfo.signalSemaphoreCount = 1;
+			submitInfo.pSignalSemaphores = &m_renderFinishedSemaphores[m_imageIndex];
+		}
 
-		VkViewport viewport{};
-		viewport.x = 0;
-		viewport.y = 0;
-		viewport.width =
-		  m_renderTarget == nullptr ? static_cast<float>(m_data->swapChain.extent.width) : m_renderTarget->getSpecification().width;
-		viewport.height =
-		  m_renderTarget == nullptr ? static_cast<float>(m_data->swapChain.extent.height) : m_renderTarget->getSpecification().height;
-		viewport.minDepth = 0.f;
-		viewport.maxDepth = 1.f;
-		vkCmdSetViewport(m_data->commandBuffers[m_imageIndex][1], 0, 1, &viewport);
+		vkResetFences(m_data->device, 1, &m_inFlightFences[m_data->currentFrame]);
+		MRG_VKVALIDATE(vkQueueSubmit(m_data->graphicsQueue.handle, 1, &submitInfo, m_inFlightFences[m_data->currentFrame]),
+		               "failed to submit draw command buffer!")
 
-		VkRect2D scissor{};
-		scissor.offset = {0, 0};
-		scissor.extent = m_renderTarget == nullptr
-		                   ? m_data->swapChain.extent
-		                   : VkExtent2D{m_renderTarget->getSpecification().width, m_renderTarget->getSpecification().height};
-		vkCmdSetScissor(m_data->commandBuffers[m_imageIndex][1], 0, 1, &scissor);
+		// The fence of an early submission is waited on right away, only the one of the last submission tells when the frame is done
+		if (isLastSubmission) {
+			m_inFlightInputTimes[m_data->currentFrame] = m_frameInputTime;
+		}
+	}
 
-		vkCmdBindPipeline(m_data->commandBuffers[m_imageIndex][1], VK_PIPELINE_BIND_POINT_GRAPHICS, correctPipeline);
+	void Renderer2D::submitRecordedPasses()
+	{
+		MRG_PROFILE_FUNCTION()
 
-		VkBuffer vertexBuffer =
-		  std::static_pointer_cast<MRG::Vulkan::VertexBuffer>(m_data->vertexArray->getVertexBuffers()[0])->getHandle();
-		VkDeviceSize offset = 0;
-		auto indexBuffer = std::static_pointer_cast<MRG::Vulkan::IndexBuffer>(m_data->vertexArray->getIndexBuffer());
-		vkCmdBindVertexBuffers(m_data->commandBuffers[m_imageIndex][1], 0, 1, &vertexBuffer, &offset);
+		submitFrameCommandBuffer(false);
 
-		vkCmdBindIndexBuffer(m_data->commandBuffers[m_imageIndex][1], indexBuffer->getHandle(), 0, VK_INDEX_TYPE_UINT32);
+		{
+			MRG_PROFILE_SCOPE("Fences")
+			vkWaitForFences(m_data->device, 1, &m_inFlightFences[m_data->currentFrame], VK_TRUE, UINT64_MAX);
+		}
+		resetRecordingWorkers();
 
-		m_quadIndexCount = 0;
-		m_qvbPtr = m_qvbBase;
+		m_batchIndex = 0;
+		beginFrameCommandBuffer();
+	}
 
-		m_textureSlotindex = 1;
+	void Renderer2D::resetRecordingWorkers()
+	{
+		for (auto& worker : m_recordingWorkers[m_data->currentFrame]) {
+			if (worker.usedCommandBuffers != 0) {
+				vkResetCommandPool(m_data->device, worker.commandPool, 0);
+				worker.usedCommandBuffers = 0;
+			}
+		}
+	}
+
+	void Renderer2D::createRenderFinishedSemaphores()
+	{
+		for (const auto semaphore : m_renderFinishedSemaphores) { vkDestroySemaphore(m_data->device, semaphore, nullptr); }
+
+		VkSemaphoreCreateInfo semaphoreInfo{};
+		semaphoreInfo.sType = VK_STRUCTURE_TYPE_SEMAPHORE_CREATE_INFO;
+
+		m_renderFinishedSemaphores.resize(m_data->swapChain.imageCount);
+		for (auto& semaphore : m_renderFinishedSemaphores) {
+			MRG_VKVALIDATE(vkCreateSemaphore(m_data->device, &semaphoreInfo, nullptr, &semaphore),
+			               "failed to create semaphores for an image!")
+		}
+	}
+
+	void Renderer2D::createTimestampPools()
+	{
+		VkPhysicalDeviceProperties properties;
+		vkGetPhysicalDeviceProperties(m_data->physicalDevice, &properties);
+
+		uint32_t queueFamilyCount = 0;
+		vkGetPhysicalDeviceQueueFamilyProperties(m_data->physicalDevice, &queueFamilyCount, nullptr);
+		std::vector<VkQueueFamilyProperties> queueFamilies(queueFamilyCount);
+		vkGetPhysicalDeviceQueueFamilyProperties(m_data->physicalDevice, &queueFamilyCount, queueFamilies.data());
+
+		const auto graphicsFamily = findQueueFamilies(m_data->physicalDevice, m_data->surface).graphicsFamily.value();
+		const auto validBits = queueFamilies[graphicsFamily].timestampValidBits;
+		if (validBits == 0) {
+			MRG_ENGINE_WARN("The graphics queue does not support timestamps, GPU timings will not be available")
+			return;
+		}
+
+		m_supportsTimestamps = true;
+		m_timestampPeriod = properties.limits.timestampPeriod;
+		m_timestampMask = (validBits >= 64) ? ~uint64_t{0} : (uint64_t{1} << validBits) - 1;
+
+		VkQueryPoolCreateInfo poolInfo{};
+		poolInfo.sType = VK_STRUCTURE_TYPE_QUERY_POOL_CREATE_INFO;
+		poolInfo.queryType = VK_QUERY_TYPE_TIMESTAMP;
+		poolInfo.queryCount = maxTimestampQueries;
+
+		m_timestampPools.resize(m_maxFramesInFlight);
+		m_timestampPasses.resize(m_maxFramesInFlight);
+		for (std::size_t i = 0; i < m_maxFramesInFlight; ++i) {
+			MRG_VKVALIDATE(vkCreateQueryPool(m_data->device, &poolInfo, nullptr, &m_timestampPools[i]), "failed to create query pool!")
+			m_timestampPasses[i].reserve(maxTimestampQueries / 2);
+		}
+	}
+
+	void Renderer2D::writePassBeginTimestamp(VkCommandBuffer commandBuffer, GPUPass pass)
+	{
+		if (!m_supportsTimestamps || (m_timestampPasses[m_data->currentFrame].size() + 1) * 2 > maxTimestampQueries) {
+			return;
+		}
+
+		auto& passes = m_timestampPasses[m_data->currentFrame];
+
+		const auto query = static_cast<uint32_t>(passes.size() * 2);
+		vkCmdResetQueryPool(commandBuffer, m_timestampPools[m_data->currentFrame], query, 2);
+		vkCmdWriteTimestamp(commandBuffer, VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT, m_timestampPools[m_data->currentFrame], query);
+		passes.push_back(pass);
+		m_timestampPending = true;
+	}
+
+	void Renderer2D::writePassEndTimestamp(VkCommandBuffer commandBuffer)
+	{
+		if (!m_timestampPending) {
+			return;
+		}
+
+		const auto query = static_cast<uint32_t>(m_timestampPasses[m_data->currentFrame].size() * 2 - 1);
+		vkCmdWriteTimestamp(commandBuffer, VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT, m_timestampPools[m_data->currentFrame], query);
+		m_timestampPending = false;
+	}
+
+	void Renderer2D::readTimestamps()
+	{
+		MRG_PROFILE_FUNCTION()
+
+		if (!m_supportsTimestamps || m_timestampPasses[m_data->currentFrame].empty()) {
+			return;
+		}
+
+		auto& passes = m_timestampPasses[m_data->currentFrame];
+
+		// Every query is followed by its availability, which should always be set once the fence has been waited on
+		std::array<uint64_t, 2 * maxTimestampQueries> results{};
+		const auto queryCount = static_cast<uint32_t>(passes.size() * 2);
+		vkGetQueryPoolResults(m_data->device,
+		                      m_timestampPools[m_data->currentFrame],
+		                      0,
+		                      queryCount,
+		                      queryCount * 2 * sizeof(uint64_t),
+		                      results.data(),
+		                      2 * sizeof(uint64_t),
+		                      VK_QUERY_RESULT_64_BIT | VK_QUERY_RESULT_WITH_AVAILABILITY_BIT);
+
+		std::array<uint64_t, RenderingStatistics::gpuPassCount> passTicks{};
+		for (std::size_t i = 0; i < passes.size(); ++i) {
+			const auto* pair = results.data() + i * 4;
+			if (pair[1] == 0 || pair[3] == 0) {
+				continue;
+			}
+			passTicks[static_cast<std::size_t>(passes[i])] += (pair[2] - pair[0]) & m_timestampMask;
+		}
+		passes.clear();
+
+		for (std::size_t i = 0; i < passTicks.size(); ++i) {
+			const auto duration = static_cast<double>(passTicks[i]) * static_cast<double>(m_timestampPeriod);
+			m_gpuPassTimes[i] = static_cast<float>(duration / 1000000.0);
+			MRG_PROFILE_GPU_TIME(getGPUPassName(static_cast<GPUPass>(i)), static_cast<int64_t>(duration))
+		}
 	}
 }  // namespace MRG::Vulkan
@@ -3,6 +3,8 @@
 
 #include "Renderer/Renderer2D.h"
 
+#include "Core/ThreadPool.h"
+
 #include "Renderer/APIs/Vulkan/Framebuffer.h"
 #include "Renderer/APIs/Vulkan/Helper.h"
 #include "Renderer/APIs/Vulkan/Shader.h"
@@ -10,6 +12,7 @@
 #include "Renderer/APIs/Vulkan/VertexArray.h"
 #include "Renderer/APIs/Vulkan/WindowProperties.h"
 
+#include <chrono>
 #include <optional>
 
 namespace MRG::Vulkan
@@ -42,25 +45,6 @@ namespace MRG::Vulkan
 		void beginScene(const EditorCamera& camera) override;
 		void endScene() override;
 
-		void drawQuad(const glm::mat4& transform, const glm::vec4& color, uint32_t objectID) override;
-		void
-		drawQuad(const glm::mat4& transform, const Ref<MRG::Texture2D>& texture, float tilingFactor, const glm::vec4& tintColor) override;
-
-		void drawQuad(const glm::vec3& position, const glm::vec2& size, const glm::vec4& color) override;
-		void drawQuad(const glm::vec3& position,
-		              const glm::vec2& size,
-		              const Ref<MRG::Texture2D>& texture,
-		              float tilingFactor,
-		              const glm::vec4& tintColor) override;
-
-		void drawRotatedQuad(const glm::vec3& position, const glm::vec2& size, float rotation, const glm::vec4& color) override;
-		void drawRotatedQuad(const glm::vec3& position,
-		                     const glm::vec2& size,
-		                     float rotation,
-		                     const Ref<MRG::Texture2D>& texture,
-		                     float tilingFactor,
-		                     const glm::vec4& tintColor) override;
-
 		void setRenderTarget(Ref<MRG::Framebuffer> renderTarget) override;
 		void resetRenderTarget() override;
 		[[nodiscard]] Ref<MRG::Framebuffer> getRenderTarget() const override { return m_renderTarget; }
@@ -75,34 +59,181 @@ namespace MRG::Vulkan
 		}
 		void clear() override;
 
-		void resetStats() override { m_stats = {}; };
-		[[nodiscard]] RenderingStatistics getStats() const override { return m_stats; };
+		[[nodiscard]] RenderingStatistics getStats() const override
+		{
+			auto stats = m_stats;
+			stats.gpuPassTimes = m_gpuPassTimes;
+
+			const auto memoryStatistics = m_data->allocator.getStatistics();
+			stats.gpuMemoryBlockCount = memoryStatistics.blockCount;
+			stats.gpuAllocationCount = memoryStatistics.allocationCount;
+			stats.gpuMemoryReserved = memoryStatistics.reservedBytes;
+			stats.gpuMemoryUsed = memoryStatistics.usedBytes;
+			stats.inputToGPUCompletionLatency = m_inputToGPUCompletionLatency;
+			return stats;
+		};
+
+		void setPresentationPolicy(const PresentationPolicy& policy) override;
+		[[nodiscard]] PresentationPolicy getPresentationPolicy() const override
+		{
+			return m_pendingPresentationPolicy.value_or(m_presentationPolicy);
+		}
 
 	private:
+		// Textures that are still uploading are replaced by the white texture, and the texture table needs no slot at all
+		[[nodiscard]] float getTextureIndex(const Ref<MRG::Texture2D>& texture) override;
+		void submitQuads(Span<const glm::mat4> transforms,
+		                 const Ref<MRG::Texture2D>& texture,
+		                 float tilingFactor,
+		                 Span<const glm::vec4> colors,
+		                 Span<const uint32_t> objectIDs) override;
+		// Large spans are split into batches that worker threads fill and record into secondary command buffers
+		void submitQuadsInParallel(Span<const glm::mat4> transforms,
+		                           const Ref<MRG::Texture2D>& texture,
+		                           float tilingFactor,
+		                           Span<const glm::vec4> colors,
+		                           Span<const uint32_t> objectIDs);
 		void setupScene();
+		// Uses the clearing render pass of the current target instead when a clear is pending
+		void beginRenderPass(VkSubpassContents contents);
+		// Records an empty clearing pass when the current target is about to be left without having been drawn to since its clear
+		void recordPendingClear();
+		// Secondary command buffers inherit nothing from the primary one, so this state is recorded in both
+		void recordSceneState(VkCommandBuffer commandBuffer) const;
 		void cleanupSwapChain();
 		void recreateSwapChain();
-		void updateDescriptor();
-		void flushAndReset();
+		// Only safe once the fence of the current frame has been waited on. destroyAll also destroys the retired semaphores, so it
+		// requires the device to be idle.
+		void destroyRetiredSwapChains(bool destroyAll);
+		// Called at the end of a frame, only waits for the device to be idle when the number of frames in flight changes
+		void applyPresentationPolicy();
+		// Only safe once the device is idle
+		void resizeFrameResources(std::size_t framesInFlight);
+		// Records the latency of the frames whose fence has been signaled since the last call, the end time being the time of the call
+		void updateLatency();
+		void updateDescriptor(VkDescriptorSet descriptorSet);
+		[[nodiscard]] Ref<VertexBuffer> getVertexPage(uint32_t batchIndex);
+		void startBatch();
+		void recordBatch();
+		void flushAndReset() override;
+		void submitAndRestartScene();
+		void beginFrameCommandBuffer();
+		// Only the last submission of a frame signals the semaphore the presentation waits on
+		void submitFrameCommandBuffer(bool isLastSubmission);
+		// Submits the passes recorded so far and waits for them, so that their descriptor sets can be used again
+		void submitRecordedPasses();
+		// Only safe once the GPU is done with the command buffers recorded by the workers for the current frame
+		void resetRecordingWorkers();
+		void createRenderFinishedSemaphores();
+		void createTimestampPools();
+		// Both must be recorded outside of a render pass
+		void writePassBeginTimestamp(VkCommandBuffer commandBuffer, GPUPass pass);
+		void writePassEndTimestamp(VkCommandBuffer commandBuffer);
+		// Only safe once the fence of the current frame has been waited on
+		void readTimestamps();
+
+		[[nodiscard]] uint32_t getPageSize() const
+		{
+			return (m_renderingMode == QuadRenderingMode::Instanced) ? static_cast<uint32_t>(maxQuads * sizeof(QuadInstance))
+			                                                          : static_cast<uint32_t>(maxVertices * sizeof(QuadVertex));
+		}
+		[[nodiscard]] VkDescriptorSet getBatchDescriptorSet(uint32_t batchIndex) const
+		{
+			return m_descriptorSets[m_imageIndex * maxBatchesPerSubmit + batchIndex];
+		}
+		[[nodiscard]] VkCommandBuffer getFrameCommandBuffer() const { return m_data->commandBuffers[m_data->currentFrame]; }
+		[[nodiscard]] VkRenderPass getSceneRenderPass() const
+		{
+			return (m_renderTarget != nullptr) ? m_renderTarget->getRenderingPipeline().getRenderpass()
+			                                   : m_data->renderingPipeline.getRenderpass();
+		}
+		[[nodiscard]] VkRenderPass getSceneClearingRenderPass() const
+		{
+			return (m_renderTarget != nullptr) ? m_renderTarget->getRenderingPipeline().getClearingRenderpass()
+			                                   : m_data->renderingPipeline.getClearingRenderpass();
+		}
+		[[nodiscard]] VkFramebuffer getSceneFramebuffer() const
+		{
+			return (m_renderTarget != nullptr) ? m_renderTarget->getHandle() : m_data->swapChain.frameBuffers[m_imageIndex][0];
+		}
+
+		// Number of batches that can be recorded in a frame before its passes have to be submitted early and waited on.
+		static const uint32_t maxBatchesPerSubmit = 32;
+		// Below this many quads, splitting the work between threads costs more than it saves
+		static const uint32_t minParallelQuads = 2 * maxQuads;
+		// Every pass submission takes a pair of queries, the submissions past that in a frame are not timed
+		static const uint32_t maxTimestampQueries = 64;
+		// Past this many retired render finished semaphores, the next swap chain recreation waits for the device to destroy them
+		static const uint32_t maxRetiredSemaphores = 64;
+
+		struct RetiredSwapChain
+		{
+			SwapChain swapChain;
+			VkDescriptorPool descriptorPool{};
+			// Number of the last frame that may still use these resources
+			uint64_t lastFrame = 0;
+		};
+
+		struct RecordingWorker
+		{
+			VkCommandPool commandPool{};
+			std::vector<VkCommandBuffer> commandBuffers;
+			std::size_t usedCommandBuffers = 0;
+		};
 
 		WindowProperties* m_data{};
 		uint32_t m_imageIndex{};
 		std::size_t m_maxFramesInFlight = 2;
+		PresentationPolicy m_presentationPolicy;
+		std::optional<PresentationPolicy> m_pendingPresentationPolicy;
 		std::vector<VkSemaphore> m_imageAvailableSemaphores;
+		// One per swapchain image, as the presentation engine may still be waiting on the one of a frame when the next one ends
+		std::vector<VkSemaphore> m_renderFinishedSemaphores;
+		// Waited on by presentation operations of retired swap chains, which no fence covers, so they are only destroyed once the
+		// device is idle. The specification doesn't strictly guarantee even that: only the present fences of
+		// VK_EXT_swapchain_maintenance1 tell when a presentation is done with its semaphore.
+		std::vector<VkSemaphore> m_retiredRenderFinishedSemaphores;
+		bool m_hasWaitedForImage = false;
 		std::vector<VkFence> m_inFlightFences, m_imagesInFlight;
 		Ref<Texture2D> m_whiteTexture;
+		// Persistently mapped vertex pages (one batch each), indexed by frame in flight then batch. They are created on demand.
+		std::vector<std::vector<Ref<VertexBuffer>>> m_vertexPages;
+		uint32_t m_batchIndex = 0;
 		VkDescriptorPool m_descriptorPool{};
 		std::vector<VkDescriptorSet> m_descriptorSets;
 		bool m_shouldRecreateSwapChain = false;
+		std::vector<RetiredSwapChain> m_retiredSwapChains;
+		bool m_isDepthBufferInitialized = false;
+		// Number of frames presented since the initialization
+		uint64_t m_frameNumber = 0;
+		Scope<ThreadPool> m_threadPool;
+		// Command pools can only be used by one thread at a time, so every worker gets its own, indexed by frame in flight then worker
+		std::vector<std::vector<RecordingWorker>> m_recordingWorkers;
 
 		bool m_sceneInProgress = false;
+		// Empty unless the current target was cleared and no pass has been recorded on it since
+		std::vector<VkClearValue> m_pendingClearValues;
 
 		PushConstants m_modelMatrix{};
 
 		glm::vec4 m_clearColor = {0.f, 0.f, 0.f, 1.f};
 		Ref<Framebuffer> m_renderTarget;
 
-		RenderingStatistics m_stats;
+		// One timestamp query pool per frame in flight, read back once the frame's fence is signaled so that it never stalls
+		bool m_supportsTimestamps = false;
+		float m_timestampPeriod = 1.f;  // Nanoseconds per timestamp tick
+		uint64_t m_timestampMask = ~uint64_t{0};
+		std::vector<VkQueryPool> m_timestampPools;
+		// The pass of every query pair written in each pool
+		std::vector<std::vector<GPUPass>> m_timestampPasses;
+		bool m_timestampPending = false;
+		std::array<float, RenderingStatistics::gpuPassCount> m_gpuPassTimes{};
+
+		// The window polls its events right before the end of a frame, the input being handled by the next one
+		std::optional<std::chrono::steady_clock::time_point> m_frameInputTime;
+		// Input time of the frame last submitted in each frame in flight, until its fence is signaled
+		std::vector<std::optional<std::chrono::steady_clock::time_point>> m_inFlightInputTimes;
+		float m_inputToGPUCompletionLatency = 0.f;
 	};
 }  // namespace MRG::Vulkan
 
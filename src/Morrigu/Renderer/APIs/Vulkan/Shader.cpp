@@ -5,7 +5,9 @@
 #include "Renderer/Renderer2D.h"
 
 #include <filesystem>
+#include <functional>
 #include <ios>
+#include <string_view>
 
 namespace
 {
@@ -39,6 +41,11 @@ namespace
 		MRG_VKVALIDATE(vkCreateShaderModule(device, &createInfo, nullptr, &returnShader), "failed to create shader!")
 		return returnShader;
 	}
+
+	[[nodiscard]] uint64_t hashCode(const std::vector<char>& code)
+	{
+		return std::hash<std::string_view>{}(std::string_view{code.data(), code.size()});
+	}
 }  // namespace
 
 namespace MRG::Vulkan
@@ -47,9 +54,14 @@ namespace MRG::Vulkan
 	{
 		MRG_PROFILE_FUNCTION()
 
+		// In instanced mode, quads are expanded by a dedicated vertex stage, which compile.sh builds into every module.
+		const auto isInstanced = Renderer2D::getQuadRenderingMode() == QuadRenderingMode::Instanced;
+		// Same goes for the fragment stage when textures are sampled from the texture table.
+		const auto data = static_cast<WindowProperties*>(glfwGetWindowUserPointer(Renderer2D::getGLFWWindow()));
+
 		std::filesystem::path shaderDir{filePath};
-		std::filesystem::path vertFile{filePath + "/vert.spv"};
-		std::filesystem::path fragFile{filePath + "/frag.spv"};
+		std::filesystem::path vertFile{filePath + (isInstanced ? "/vert_instanced.spv" : "/vert.spv")};
+		std::filesystem::path fragFile{filePath + (data->supportsTextureTable ? "/frag_indexed.spv" : "/frag.spv")};
 		MRG_CORE_ASSERT(std::filesystem::exists(shaderDir), fmt::format("Directory '{}' does not exist!", filePath))
 		MRG_CORE_ASSERT(std::filesystem::is_directory(shaderDir),
 		                fmt::format("Specified path '{}' doesn't reference a directory!", filePath))
@@ -60,10 +72,11 @@ namespace MRG::Vulkan
 		const auto vertShaderSrc = readFile(vertFile.string());
 		const auto fragShaderSrc = readFile(fragFile.string());
 
-		const auto data = static_cast<WindowProperties*>(glfwGetWindowUserPointer(Renderer2D::getGLFWWindow()));
-
 		vertexShaderModule = createShader(vertShaderSrc, data->device);
 		fragmentShaderModule = createShader(fragShaderSrc, data->device);
+		// Combined the same way as boost::hash_combine
+		m_codeHash = hashCode(vertShaderSrc);
+		m_codeHash ^= hashCode(fragShaderSrc) + 0x9e3779b97f4a7c15 + (m_codeHash << 6) + (m_codeHash >> 2);
 	}
 
 	Shader::~Shader() { Shader::destroy(); }
@@ -80,6 +93,8 @@ namespace MRG::Vulkan
 
 		vkDestroyShaderModule(data->device, vertexShaderModule, nullptr);
 		vkDestroyShaderModule(data->device, fragmentShaderModule, nullptr);
+		// The pipelines already created from it stay valid, they just can't be shared with new ones anymore
+		data->pipelineCache.evict(m_codeHash);
 
 		m_isDestroyed = true;
 	}
@@ -32,11 +32,14 @@ namespace MRG::Vulkan
 		void upload(const std::string& name, const glm::mat4& value) override;
 
 		[[nodiscard]] const std::string& getName() const override { return m_name; }
+		// Identifies the SPIR-V code of both stages, unlike the module handles which may be reused once the shader is destroyed
+		[[nodiscard]] uint64_t getCodeHash() const { return m_codeHash; }
 
 		VkShaderModule vertexShaderModule, fragmentShaderModule;
 
 	private:
 		std::string m_name;
+		uint64_t m_codeHash = 0;
 	};
 }  // namespace MRG::Vulkan
 
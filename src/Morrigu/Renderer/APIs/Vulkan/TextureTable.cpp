@@ -0,0 +1,119 @@
+#include "TextureTable.h"
+
+#include "Debug/Instrumentor.h"
+#include "Renderer/APIs/Vulkan/Helper.h"
+
+#include <algorithm>
+#include <array>
+
+namespace MRG::Vulkan
+{
+	void TextureTable::init(VkDevice device, VkDescriptorSetLayout layout)
+	{
+		MRG_PROFILE_FUNCTION()
+
+		m_device = device;
+
+		std::array<VkDescriptorPoolSize, 2> poolSizes{};
+		poolSizes[0].type = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER;
+		poolSizes[0].descriptorCount = 1;
+		poolSizes[1].type = VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER;
+		poolSizes[1].descriptorCount = maxTextures;
+
+		VkDescriptorPoolCreateInfo poolInfo{};
+		poolInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_POOL_CREATE_INFO;
+		poolInfo.flags = VK_DESCRIPTOR_POOL_CREATE_UPDATE_AFTER_BIND_BIT;
+		poolInfo.poolSizeCount = static_cast<uint32_t>(poolSizes.size());
+		poolInfo.pPoolSizes = poolSizes.data();
+		poolInfo.maxSets = 1;
+
+		MRG_VKVALIDATE(vkCreateDescriptorPool(m_device, &poolInfo, nullptr, &m_descriptorPool), "failed to create texture table pool!")
+
+		VkDescriptorSetAllocateInfo allocInfo{};
+		allocInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_ALLOCATE_INFO;
+		allocInfo.descriptorPool = m_descriptorPool;
+		allocInfo.descriptorSetCount = 1;
+		allocInfo.pSetLayouts = &layout;
+
+		MRG_VKVALIDATE(vkAllocateDescriptorSets(m_device, &allocInfo, &m_descriptorSet), "failed to allocate texture table!")
+
+		m_freeIndices.clear();
+		m_releasedIndices.clear();
+		m_nextIndex = 0;
+		m_frameNumber = 0;
+	}
+
+	void TextureTable::destroy()
+	{
+		if (!isInitialized()) {
+			return;
+		}
+
+		vkDestroyDescriptorPool(m_device, m_descriptorPool, nullptr);
+		m_descriptorPool = VK_NULL_HANDLE;
+		m_descriptorSet = VK_NULL_HANDLE;
+	}
+
+	uint32_t TextureTable::allocate(VkImageView imageView, VkSampler sampler)
+	{
+		uint32_t index;
+		if (!m_freeIndices.empty()) {
+			index = m_freeIndices.back();
+			m_freeIndices.pop_back();
+		} else {
+			// Writing past the end of the descriptor array is undefined behavior, so this can't only be checked in debug builds
+			if (m_nextIndex >= maxTextures) {
+				throw std::runtime_error("texture table is full!");
+			}
+			index = m_nextIndex++;
+		}
+
+		update(index, imageView, sampler);
+		return index;
+	}
+
+	void TextureTable::update(uint32_t index, VkImageView imageView, VkSampler sampler)
+	{
+		VkDescriptorImageInfo imageInfo{};
+		imageInfo.imageLayout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
+		imageInfo.imageView = imageView;
+		imageInfo.sampler = sampler;
+
+		VkWriteDescriptorSet descriptorWrite{};
+		descriptorWrite.sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
+		descriptorWrite.dstSet = m_descriptorSet;
+		descriptorWrite.dstBinding = 1;
+		descriptorWrite.dstArrayElement = index;
+		descriptorWrite.descriptorType = VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER;
+		descriptorWrite.descriptorCount = 1;
+		descriptorWrite.pImageInfo = &imageInfo;
+
+		vkUpdateDescriptorSets(m_device, 1, &descriptorWrite, 0, nullptr);
+	}
+
+	void TextureTable::release(uint32_t index)
+	{
+		// Released slots are left untouched: partially bound descriptors are never read unless a quad references them. They still
+		// can't be written right away, as the descriptor set is updated after bind and frames in flight may be sampling them.
+		if (index != invalidIndex && isInitialized()) {
+			m_releasedIndices.push_back({index, m_frameNumber});
+		}
+	}
+
+	void TextureTable::recycleReleasedIndices(uint64_t frameNumber, std::size_t framesInFlight)
+	{
+		m_frameNumber = frameNumber;
+
+		const auto isUnused = [frameNumber, framesInFlight](const ReleasedIndex& releasedIndex) {
+			return releasedIndex.lastFrame + framesInFlight <= frameNumber;
+		};
+
+		for (const auto& releasedIndex : m_releasedIndices) {
+			if (isUnused(releasedIndex)) {
+				m_freeIndices.push_back(releasedIndex.index);
+			}
+		}
+
+		m_releasedIndices.erase(std::remove_if(m_releasedIndices.begin(), m_releasedIndices.end(), isUnused), m_releasedIndices.end());
+	}
+}  // namespace MRG::Vulkan
@@ -0,0 +1,52 @@
+#ifndef MRG_VULKAN_IMPL_TEXTURETABLE
+#define MRG_VULKAN_IMPL_TEXTURETABLE
+
+#include "Renderer/APIs/Vulkan/VulkanHPPIncludeHelper.h"
+
+#include <vector>
+
+namespace MRG::Vulkan
+{
+	// Single descriptor set holding every live texture, indexed in the shaders through descriptor indexing.
+	// Each texture image keeps the same slot for its whole lifetime, so texture changes never split a batch.
+	class TextureTable
+	{
+	public:
+		static const uint32_t maxTextures = 4096;
+		static const uint32_t invalidIndex = UINT32_MAX;
+
+		void init(VkDevice device, VkDescriptorSetLayout layout);
+		void destroy();
+
+		// Throws once every slot is in use, as the descriptor array can't grow
+		[[nodiscard]] uint32_t allocate(VkImageView imageView, VkSampler sampler);
+		// The slot is only reused once the frames that may still sample it are done, see recycleReleasedIndices
+		void release(uint32_t index);
+		// Called once the fence of the frame framesInFlight frames before frameNumber has been waited on
+		void recycleReleasedIndices(uint64_t frameNumber, std::size_t framesInFlight);
+
+		[[nodiscard]] VkDescriptorSet getDescriptorSet() const { return m_descriptorSet; }
+		[[nodiscard]] bool isInitialized() const { return m_descriptorSet != VK_NULL_HANDLE; }
+
+	private:
+		void update(uint32_t index, VkImageView imageView, VkSampler sampler);
+
+		VkDevice m_device{};
+		VkDescriptorPool m_descriptorPool{};
+		VkDescriptorSet m_descriptorSet{};
+
+		struct ReleasedIndex
+		{
+			uint32_t index;
+			// Number of the last frame that may still sample the slot
+			uint64_t lastFrame;
+		};
+
+		std::vector<uint32_t> m_freeIndices;
+		std::vector<ReleasedIndex> m_releasedIndices;
+		uint32_t m_nextIndex = 0;
+		uint64_t m_frameNumber = 0;
+	};
+}  // namespace MRG::Vulkan
+
+#endif
@@ -15,7 +15,7 @@ namespace MRG::Vulkan
 
 		const auto windowData = static_cast<WindowProperties*>(glfwGetWindowUserPointer(Renderer2D::getGLFWWindow()));
 
-		createImage(windowData->physicalDevice,
+		createImage(windowData->allocator,
 		            windowData->device,
 		            m_width,
 		            m_height,
@@ -24,9 +24,10 @@ namespace MRG::Vulkan
 		            VK_IMAGE_USAGE_TRANSFER_DST_BIT | VK_IMAGE_USAGE_SAMPLED_BIT,
 		            VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT,
 		            m_imageHandle,
-		            m_memoryHandle);
+		            m_allocation,
+		            windowData->uploadContext.getSharingQueueFamilies());
 
-		transitionImageLayout(windowData, m_imageHandle, VK_IMAGE_LAYOUT_UNDEFINED, VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL);
+		m_uploadTicket = windowData->uploadContext.initializeImage(m_imageHandle);
 
 		m_imageView = createImageView(windowData->device, m_imageHandle, VK_FORMAT_R8G8B8A8_UNORM, VK_IMAGE_ASPECT_COLOR_BIT);
 
@@ -49,6 +50,8 @@ namespace MRG::Vulkan
 		samplerInfo.maxLod = 0.f;
 
 		MRG_VKVALIDATE(vkCreateSampler(windowData->device, &samplerInfo, nullptr, &m_sampler), "failed to create texture sampler!")
+
+		registerInTable();
 	}
 
 	Texture2D::Texture2D(const std::string& path)
@@ -83,17 +86,43 @@ namespace MRG::Vulkan
 
 		const auto windowData = static_cast<WindowProperties*>(glfwGetWindowUserPointer(Renderer2D::getGLFWWindow()));
 
+		// The image can't be destroyed while the transfer queue still writes to it
+		windowData->uploadContext.wait(m_uploadTicket);
+		m_uploadTicket = 0;
+
 		vkDestroySampler(windowData->device, m_sampler, nullptr);
 		vkDestroyImageView(windowData->device, m_imageView, nullptr);
 
 		vkDestroyImage(windowData->device, m_imageHandle, nullptr);
-		vkFreeMemory(windowData->device, m_memoryHandle, nullptr);
+		windowData->allocator.free(m_allocation);
+
+		if (m_tableIndex != TextureTable::invalidIndex) {
+			windowData->textureTable.release(m_tableIndex);
+			m_tableIndex = TextureTable::invalidIndex;
+		}
 
 		m_isDestroyed = true;
 	}
 
+	bool Texture2D::isReady() const
+	{
+		const auto windowData = static_cast<WindowProperties*>(glfwGetWindowUserPointer(Renderer2D::getGLFWWindow()));
+		return windowData->uploadContext.isComplete(m_uploadTicket);
+	}
+
+	void Texture2D::waitUntilReady() const
+	{
+		MRG_PROFILE_FUNCTION()
+
+		const auto windowData = static_cast<WindowProperties*>(glfwGetWindowUserPointer(Renderer2D::getGLFWWindow()));
+		windowData->uploadContext.wait(m_uploadTicket);
+	}
+
 	ImTextureID Texture2D::getImTextureID()
 	{
+		// ImGui samples the texture through its own descriptor set, which the renderer can't swap for the white texture
+		waitUntilReady();
+
 		if (m_ImTextureID == nullptr) {
 			m_ImTextureID = ImGui_ImplVulkan_AddTexture(m_sampler, m_imageView, VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL);
 		}
@@ -105,25 +134,13 @@ namespace MRG::Vulkan
 	{
 		MRG_PROFILE_FUNCTION()
 
+		// The new image gets a new texture table slot: frames in flight may still be sampling the old one, which can't be rewritten
 		destroy();
 
 		MRG_CORE_ASSERT(size == m_width * m_width * 4, "Data size is incorrect!")
 
 		const auto windowData = static_cast<WindowProperties*>(glfwGetWindowUserPointer(Renderer2D::getGLFWWindow()));
-		Buffer stagingBuffer{};
-		createBuffer(windowData->device,
-		             windowData->physicalDevice,
-		             size,
-		             VK_BUFFER_USAGE_TRANSFER_SRC_BIT,
-		             VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT,
-		             stagingBuffer);
-
-		void* data;
-		vkMapMemory(windowData->device, stagingBuffer.memoryHandle, 0, size, 0, &data);
-		memcpy(data, pixels, static_cast<std::size_t>(size));
-		vkUnmapMemory(windowData->device, stagingBuffer.memoryHandle);
-
-		createImage(windowData->physicalDevice,
+		createImage(windowData->allocator,
 		            windowData->device,
 		            m_width,
 		            m_height,
@@ -132,14 +149,11 @@ namespace MRG::Vulkan
 		            VK_IMAGE_USAGE_TRANSFER_DST_BIT | VK_IMAGE_USAGE_SAMPLED_BIT,
 		            VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT,
 		            m_imageHandle,
-		            m_memoryHandle);
+		            m_allocation,
+		            windowData->uploadContext.getSharingQueueFamilies());
 
-		transitionImageLayout(windowData, m_imageHandle, VK_IMAGE_LAYOUT_UNDEFINED, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL);
-		copyBufferToImage(windowData, stagingBuffer.handle, m_imageHandle, m_width, m_height);
-		transitionImageLayout(windowData, m_imageHandle, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL);
-
-		vkDestroyBuffer(windowData->device, stagingBuffer.handle, nullptr);
-		vkFreeMemory(windowData->device, stagingBuffer.memoryHandle, nullptr);
+		// The upload is only recorded here, and submitted with the other ones at the start of the next frame
+		m_uploadTicket = windowData->uploadContext.uploadImage(pixels, size, m_imageHandle, m_width, m_height);
 
 		m_imageView = createImageView(windowData->device, m_imageHandle, VK_FORMAT_R8G8B8A8_UNORM, VK_IMAGE_ASPECT_COLOR_BIT);
 
@@ -163,9 +177,21 @@ namespace MRG::Vulkan
 
 		MRG_VKVALIDATE(vkCreateSampler(windowData->device, &samplerInfo, nullptr, &m_sampler), "failed to create texture sampler!")
 
+		registerInTable();
+
 		m_isDestroyed = false;
 	}
 
+	void Texture2D::registerInTable()
+	{
+		const auto windowData = static_cast<WindowProperties*>(glfwGetWindowUserPointer(Renderer2D::getGLFWWindow()));
+		if (!windowData->textureTable.isInitialized()) {
+			return;
+		}
+
+		m_tableIndex = windowData->textureTable.allocate(m_imageView, m_sampler);
+	}
+
 	void Texture2D::bind(uint32_t) const
 	{
 		// MRG_PROFILE_FUNCTION()
@@ -23,8 +23,10 @@ namespace MRG::Vulkan
 		[[nodiscard]] uint32_t getWidth() const override { return m_width; };
 		[[nodiscard]] uint32_t getHeight() const override { return m_height; };
 		[[nodiscard]] ImTextureID getImTextureID() override;
+		[[nodiscard]] bool isReady() const override;
+		void waitUntilReady() const;
 		[[nodiscard]] VkImage& getHandle() { return m_imageHandle; }
-		[[nodiscard]] VkDeviceMemory& getMemoryHandle() { return m_memoryHandle; }
+		[[nodiscard]] VkDeviceMemory getMemoryHandle() const { return m_allocation.memoryHandle; }
 		[[nodiscard]] static VkFormat getFormat() { return VK_FORMAT_R8G8B8A8_UNORM; }
 
 		bool operator==(const Texture& other) const override { return m_imageHandle == ((Vulkan::Texture2D&)other).m_imageHandle; }
@@ -35,14 +37,19 @@ namespace MRG::Vulkan
 
 		[[nodiscard]] VkImageView getImageView() const { return m_imageView; };
 		[[nodiscard]] VkSampler getSampler() const { return m_sampler; };
+		[[nodiscard]] uint32_t getTableIndex() const { return m_tableIndex; };
 
 	private:
+		void registerInTable();
+
 		ImTextureID m_ImTextureID = nullptr;
 
 		VkImage m_imageHandle{};
-		VkDeviceMemory m_memoryHandle{};
+		Allocation m_allocation{};
 		VkImageView m_imageView{};
 		VkSampler m_sampler{};
+		uint32_t m_tableIndex = TextureTable::invalidIndex;
+		uint64_t m_uploadTicket = 0;
 		uint32_t m_width, m_height;
 	};
 }  // namespace MRG::Vulkan
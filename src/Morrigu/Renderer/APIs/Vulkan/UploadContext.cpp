@@ -0,0 +1,322 @@
+#include "UploadContext.h"
+
+#include "Debug/Instrumentor.h"
+#include "Renderer/APIs/Vulkan/Helper.h"
+
+#include <cstring>
+
+namespace
+{
+	void recordImageBarrier(VkCommandBuffer commandBuffer,
+	                        VkImage image,
+	                        VkImageLayout oldLayout,
+	                        VkImageLayout newLayout,
+	                        VkAccessFlags srcAccessMask,
+	                        VkAccessFlags dstAccessMask,
+	                        VkPipelineStageFlags sourceStage,
+	                        VkPipelineStageFlags destinationStage)
+	{
+		VkImageMemoryBarrier barrier{};
+		barrier.sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER;
+		barrier.oldLayout = oldLayout;
+		barrier.newLayout = newLayout;
+		barrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+		barrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+		barrier.srcAccessMask = srcAccessMask;
+		barrier.dstAccessMask = dstAccessMask;
+		barrier.image = image;
+		barrier.subresourceRange.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
+		barrier.subresourceRange.baseMipLevel = 0;
+		barrier.subresourceRange.levelCount = 1;
+		barrier.subresourceRange.baseArrayLayer = 0;
+		barrier.subresourceRange.layerCount = 1;
+
+		vkCmdPipelineBarrier(commandBuffer, sourceStage, destinationStage, 0, 0, nullptr, 0, nullptr, 1, &barrier);
+	}
+}  // namespace
+
+namespace MRG::Vulkan
+{
+	void UploadContext::init(VkDevice device, MemoryAllocator& allocator, const Queue& graphicsQueue, const Queue& transferQueue)
+	{
+		MRG_PROFILE_FUNCTION()
+
+		m_device = device;
+		m_allocator = &allocator;
+		m_queue = transferQueue.handle;
+		m_isDedicatedQueue = transferQueue.index != graphicsQueue.index;
+		if (m_isDedicatedQueue) {
+			m_sharingQueueFamilies = {graphicsQueue.index, transferQueue.index};
+		}
+
+		VkCommandPoolCreateInfo poolInfo{};
+		poolInfo.sType = VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO;
+		poolInfo.flags = VK_COMMAND_POOL_CREATE_TRANSIENT_BIT | VK_COMMAND_POOL_CREATE_RESET_COMMAND_BUFFER_BIT;
+		poolInfo.queueFamilyIndex = transferQueue.index;
+
+		MRG_VKVALIDATE(vkCreateCommandPool(m_device, &poolInfo, nullptr, &m_commandPool), "failed to create upload command pool!")
+	}
+
+	void UploadContext::destroy()
+	{
+		MRG_PROFILE_FUNCTION()
+
+		flush();
+
+		std::lock_guard lock(m_mutex);
+		retireBatches(true, m_nextTicket);
+
+		for (const auto& batch : m_freeBatches) {
+			vkDestroyFence(m_device, batch.fence, nullptr);
+			vkFreeCommandBuffers(m_device, m_commandPool, 1, &batch.commandBuffer);
+		}
+		m_freeBatches.clear();
+
+		vkDestroyCommandPool(m_device, m_commandPool, nullptr);
+	}
+
+	uint64_t UploadContext::uploadImage(const void* pixels, VkDeviceSize size, VkImage image, uint32_t width, uint32_t height)
+	{
+		MRG_PROFILE_FUNCTION()
+
+		const auto stagingBuffer = createStagingBuffer(pixels, size);
+
+		std::lock_guard lock(m_mutex);
+		const auto commandBuffer = getCommandBuffer();
+
+		recordImageBarrier(commandBuffer,
+		                   image,
+		                   VK_IMAGE_LAYOUT_UNDEFINED,
+		                   VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
+		                   0,
+		                   VK_ACCESS_TRANSFER_WRITE_BIT,
+		                   VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT,
+		                   VK_PIPELINE_STAGE_TRANSFER_BIT);
+
+		VkBufferImageCopy region{};
+		region.imageSubresource.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
+		region.imageSubresource.mipLevel = 0;
+		region.imageSubresource.baseArrayLayer = 0;
+		region.imageSubresource.layerCount = 1;
+		region.imageOffset = {0, 0, 0};
+		region.imageExtent = {width, height, 1};
+		vkCmdCopyBufferToImage(commandBuffer, stagingBuffer.handle, image, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, 1, &region);
+
+		// A transfer only queue has no fragment shader stage, the fence of the batch then orders the copy before the draws
+		recordImageBarrier(commandBuffer,
+		                   image,
+		                   VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
+		                   VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL,
+		                   VK_ACCESS_TRANSFER_WRITE_BIT,
+		                   m_isDedicatedQueue ? 0 : VK_ACCESS_SHADER_READ_BIT,
+		                   VK_PIPELINE_STAGE_TRANSFER_BIT,
+		                   m_isDedicatedQueue ? VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT : VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT);
+
+		return addStagingBuffer(stagingBuffer, size);
+	}
+
+	uint64_t UploadContext::initializeImage(VkImage image)
+	{
+		MRG_PROFILE_FUNCTION()
+
+		std::lock_guard lock(m_mutex);
+		recordImageBarrier(getCommandBuffer(),
+		                   image,
+		                   VK_IMAGE_LAYOUT_UNDEFINED,
+		                   VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL,
+		                   0,
+		                   0,
+		                   VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT,
+		                   VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT);
+
+		return m_currentBatch.ticket;
+	}
+
+	uint64_t UploadContext::uploadBuffer(const void* data, VkDeviceSize size, VkBuffer buffer)
+	{
+		MRG_PROFILE_FUNCTION()
+
+		const auto stagingBuffer = createStagingBuffer(data, size);
+
+		std::lock_guard lock(m_mutex);
+		const auto commandBuffer = getCommandBuffer();
+
+		VkBufferCopy copyRegion{};
+		copyRegion.size = size;
+		vkCmdCopyBuffer(commandBuffer, stagingBuffer.handle, buffer, 1, &copyRegion);
+
+		// Orders the copy before a later upload to the same buffer. As for images, the fence of the batch orders it before the draws
+		// when the transfer queue is a dedicated one.
+		VkBufferMemoryBarrier barrier{};
+		barrier.sType = VK_STRUCTURE_TYPE_BUFFER_MEMORY_BARRIER;
+		barrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+		barrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+		barrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+		barrier.dstAccessMask =
+		  VK_ACCESS_TRANSFER_WRITE_BIT | (m_isDedicatedQueue ? 0 : VK_ACCESS_VERTEX_ATTRIBUTE_READ_BIT | VK_ACCESS_INDEX_READ_BIT);
+		barrier.buffer = buffer;
+		barrier.offset = 0;
+		barrier.size = size;
+		vkCmdPipelineBarrier(commandBuffer,
+		                     VK_PIPELINE_STAGE_TRANSFER_BIT,
+		                     VK_PIPELINE_STAGE_TRANSFER_BIT | (m_isDedicatedQueue ? 0 : VK_PIPELINE_STAGE_VERTEX_INPUT_BIT),
+		                     0,
+		                     0,
+		                     nullptr,
+		                     1,
+		                     &barrier,
+		                     0,
+		                     nullptr);
+
+		return addStagingBuffer(stagingBuffer, size);
+	}
+
+	void UploadContext::flush()
+	{
+		MRG_PROFILE_FUNCTION()
+
+		std::lock_guard lock(m_mutex);
+		if (m_isRecording) {
+			submitBatch();
+		}
+	}
+
+	void UploadContext::update()
+	{
+		MRG_PROFILE_FUNCTION()
+
+		std::lock_guard lock(m_mutex);
+		retireBatches(false, m_nextTicket);
+	}
+
+	bool UploadContext::isComplete(uint64_t ticket)
+	{
+		std::lock_guard lock(m_mutex);
+		if (ticket > m_completedTicket) {
+			retireBatches(false, ticket);
+		}
+
+		return ticket <= m_completedTicket;
+	}
+
+	void UploadContext::wait(uint64_t ticket)
+	{
+		MRG_PROFILE_FUNCTION()
+
+		std::lock_guard lock(m_mutex);
+		if (ticket <= m_completedTicket) {
+			return;
+		}
+
+		if (m_isRecording && ticket >= m_currentBatch.ticket) {
+			submitBatch();
+		}
+		retireBatches(true, ticket);
+	}
+
+	Buffer UploadContext::createStagingBuffer(const void* data, VkDeviceSize size)
+	{
+		Buffer stagingBuffer{};
+		createBuffer(m_device,
+		             *m_allocator,
+		             size,
+		             VK_BUFFER_USAGE_TRANSFER_SRC_BIT,
+		             VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT,
+		             stagingBuffer);
+		memcpy(stagingBuffer.allocation.mappedData, data, static_cast<std::size_t>(size));
+
+		return stagingBuffer;
+	}
+
+	uint64_t UploadContext::addStagingBuffer(const Buffer& stagingBuffer, VkDeviceSize size)
+	{
+		m_currentBatch.stagingBuffers.emplace_back(stagingBuffer);
+		m_currentBatch.stagingSize += size;
+		const auto ticket = m_currentBatch.ticket;
+
+		if (m_currentBatch.stagingSize >= maxBatchStagingSize) {
+			submitBatch();
+		}
+
+		return ticket;
+	}
+
+	VkCommandBuffer UploadContext::getCommandBuffer()
+	{
+		if (m_isRecording) {
+			return m_currentBatch.commandBuffer;
+		}
+
+		if (!m_freeBatches.empty()) {
+			m_currentBatch = std::move(m_freeBatches.back());
+			m_freeBatches.pop_back();
+			MRG_VKVALIDATE(vkResetFences(m_device, 1, &m_currentBatch.fence), "failed to reset upload fence!")
+		} else {
+			m_currentBatch = {};
+
+			VkCommandBufferAllocateInfo allocInfo{};
+			allocInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO;
+			allocInfo.level = VK_COMMAND_BUFFER_LEVEL_PRIMARY;
+			allocInfo.commandPool = m_commandPool;
+			allocInfo.commandBufferCount = 1;
+			MRG_VKVALIDATE(vkAllocateCommandBuffers(m_device, &allocInfo, &m_currentBatch.commandBuffer),
+			               "failed to allocate upload command buffer!")
+
+			VkFenceCreateInfo fenceInfo{};
+			fenceInfo.sType = VK_STRUCTURE_TYPE_FENCE_CREATE_INFO;
+			MRG_VKVALIDATE(vkCreateFence(m_device, &fenceInfo, nullptr, &m_currentBatch.fence), "failed to create upload fence!")
+		}
+		m_currentBatch.ticket = m_nextTicket;
+
+		VkCommandBufferBeginInfo beginInfo{};
+		beginInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
+		beginInfo.flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT;
+		MRG_VKVALIDATE(vkBeginCommandBuffer(m_currentBatch.commandBuffer, &beginInfo), "failed to begin upload command buffer!")
+
+		m_isRecording = true;
+		return m_currentBatch.commandBuffer;
+	}
+
+	void UploadContext::submitBatch()
+	{
+		MRG_PROFILE_FUNCTION()
+
+		MRG_VKVALIDATE(vkEndCommandBuffer(m_currentBatch.commandBuffer), "failed to record upload command buffer!")
+
+		VkSubmitInfo submitInfo{};
+		submitInfo.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO;
+		submitInfo.commandBufferCount = 1;
+		submitInfo.pCommandBuffers = &m_currentBatch.commandBuffer;
+		MRG_VKVALIDATE(vkQueueSubmit(m_queue, 1, &submitInfo, m_currentBatch.fence), "failed to submit upload command buffer!")
+
+		m_pendingBatches.emplace_back(std::move(m_currentBatch));
+		m_currentBatch = {};
+		m_isRecording = false;
+		++m_nextTicket;
+	}
+
+	void UploadContext::retireBatches(bool waitForCompletion, uint64_t lastTicket)
+	{
+		// Batches are retired in submission order, so that every ticket up to the completed one is known to be done
+		while (!m_pendingBatches.empty() && m_pendingBatches.front().ticket <= lastTicket) {
+			auto& batch = m_pendingBatches.front();
+			if (waitForCompletion) {
+				vkWaitForFences(m_device, 1, &batch.fence, VK_TRUE, UINT64_MAX);
+			} else if (vkGetFenceStatus(m_device, batch.fence) != VK_SUCCESS) {
+				break;
+			}
+
+			for (auto& stagingBuffer : batch.stagingBuffers) {
+				vkDestroyBuffer(m_device, stagingBuffer.handle, nullptr);
+				m_allocator->free(stagingBuffer.allocation);
+			}
+			batch.stagingBuffers.clear();
+			batch.stagingSize = 0;
+
+			m_completedTicket = batch.ticket;
+			vkResetCommandBuffer(batch.commandBuffer, 0);
+			m_freeBatches.emplace_back(std::move(batch));
+			m_pendingBatches.pop_front();
+		}
+	}
+}  // namespace MRG::Vulkan
@@ -0,0 +1,76 @@
+#ifndef MRG_VULKAN_IMPL_UPLOADCONTEXT
+#define MRG_VULKAN_IMPL_UPLOADCONTEXT
+
+#include "Renderer/APIs/Vulkan/MemoryAllocator.h"
+#include "Renderer/APIs/Vulkan/VulkanHPPIncludeHelper.h"
+
+#include <deque>
+#include <mutex>
+#include <vector>
+
+namespace MRG::Vulkan
+{
+	// Records the copies and layout transitions of resource uploads into a shared command buffer, submitted once per frame (or when
+	// its staging memory grows too large) on the transfer queue, instead of stalling the graphics queue after each of them.
+	// Every upload returns the ticket of the batch it was recorded in, which is complete once the fence of that batch is signaled.
+	class UploadContext
+	{
+	public:
+		void init(VkDevice device, MemoryAllocator& allocator, const Queue& graphicsQueue, const Queue& transferQueue);
+		void destroy();
+
+		// Copies the pixels into the image, which ends up in the shader read only layout
+		[[nodiscard]] uint64_t uploadImage(const void* pixels, VkDeviceSize size, VkImage image, uint32_t width, uint32_t height);
+		// Moves a freshly created image to the shader read only layout, leaving its content undefined
+		[[nodiscard]] uint64_t initializeImage(VkImage image);
+		// Copies the data into the start of a device local vertex or index buffer
+		[[nodiscard]] uint64_t uploadBuffer(const void* data, VkDeviceSize size, VkBuffer buffer);
+
+		// Submits the batch being recorded, if any
+		void flush();
+		// Releases the staging buffers of the batches the GPU is done with
+		void update();
+
+		[[nodiscard]] bool isComplete(uint64_t ticket);
+		void wait(uint64_t ticket);
+
+		// Images and buffers used by both queues have to be created with these families, as they never change ownership
+		[[nodiscard]] const std::vector<uint32_t>& getSharingQueueFamilies() const { return m_sharingQueueFamilies; }
+
+		static constexpr VkDeviceSize maxBatchStagingSize = 64 * 1024 * 1024;
+
+	private:
+		struct Batch
+		{
+			VkCommandBuffer commandBuffer{};
+			VkFence fence{};
+			uint64_t ticket = 0;
+			VkDeviceSize stagingSize = 0;
+			std::vector<Buffer> stagingBuffers;
+		};
+
+		[[nodiscard]] Buffer createStagingBuffer(const void* data, VkDeviceSize size);
+		// Has to be called with the mutex locked
+		[[nodiscard]] uint64_t addStagingBuffer(const Buffer& stagingBuffer, VkDeviceSize size);
+		[[nodiscard]] VkCommandBuffer getCommandBuffer();
+		void submitBatch();
+		void retireBatches(bool waitForCompletion, uint64_t lastTicket);
+
+		VkDevice m_device{};
+		MemoryAllocator* m_allocator = nullptr;
+		VkQueue m_queue{};
+		VkCommandPool m_commandPool{};
+		bool m_isDedicatedQueue = false;
+		std::vector<uint32_t> m_sharingQueueFamilies;
+
+		std::mutex m_mutex;
+		Batch m_currentBatch;
+		bool m_isRecording = false;
+		std::deque<Batch> m_pendingBatches;
+		std::vector<Batch> m_freeBatches;
+		uint64_t m_nextTicket = 1;
+		uint64_t m_completedTicket = 0;
+	};
+}  // namespace MRG::Vulkan
+
+#endif
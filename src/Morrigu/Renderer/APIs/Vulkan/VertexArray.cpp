@@ -76,7 +76,7 @@ namespace MRG::Vulkan
 
 		m_bindingDescription.binding = 0;
 		m_bindingDescription.stride = vertexBuffer->layout.getStride();
-		m_bindingDescription.inputRate = VK_VERTEX_INPUT_RATE_VERTEX;
+		m_bindingDescription.inputRate = vertexBuffer->perInstance ? VK_VERTEX_INPUT_RATE_INSTANCE : VK_VERTEX_INPUT_RATE_VERTEX;
 
 		uint32_t location = 0;
 		for (const auto& element : vertexBuffer->layout) {
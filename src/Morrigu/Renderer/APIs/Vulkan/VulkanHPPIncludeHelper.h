@@ -10,10 +10,23 @@ DISABLE_WARNING_POP
 
 namespace MRG::Vulkan
 {
+	struct MemoryBlock;
+
+	// A range of one of the memory blocks of the MemoryAllocator
+	struct Allocation
+	{
+		VkDeviceMemory memoryHandle{};
+		VkDeviceSize offset = 0;
+		VkDeviceSize size = 0;
+		void* mappedData = nullptr;  // Only set for host visible memory, which stays mapped
+		MemoryBlock* block = nullptr;
+		uint32_t order = 0;
+	};
+
 	struct LightVulkanImage
 	{
 		VkImage handle;
-		VkDeviceMemory memoryHandle;
+		Allocation allocation;
 		VkImageView imageView;
 	};
 
@@ -26,7 +39,8 @@ namespace MRG::Vulkan
 		VkFormat imageFormat{};
 		VkExtent2D extent{};
 		std::vector<VkImageView> imageViews;
-		std::vector<std::array<VkFramebuffer, 3>> frameBuffers;
+		// The main framebuffer, then the ImGui one, for every image
+		std::vector<std::array<VkFramebuffer, 2>> frameBuffers;
 		LightVulkanImage depthBuffer{};
 	};
 
@@ -39,7 +53,7 @@ namespace MRG::Vulkan
 	struct Buffer
 	{
 		VkBuffer handle;
-		VkDeviceMemory memoryHandle;
+		Allocation allocation;
 	};
 
 }  // namespace MRG::Vulkan
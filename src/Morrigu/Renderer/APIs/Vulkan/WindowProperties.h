@@ -1,7 +1,11 @@
 #ifndef MRG_VULKAN_IMPL_WINDOWPROPERTIES
 #define MRG_VULKAN_IMPL_WINDOWPROPERTIES
 
+#include "Renderer/APIs/Vulkan/MemoryAllocator.h"
 #include "Renderer/APIs/Vulkan/Pipeline.h"
+#include "Renderer/APIs/Vulkan/PipelineCache.h"
+#include "Renderer/APIs/Vulkan/TextureTable.h"
+#include "Renderer/APIs/Vulkan/UploadContext.h"
 #include "Renderer/APIs/Vulkan/VertexArray.h"
 #include "Renderer/APIs/Vulkan/VulkanHPPIncludeHelper.h"
 #include "Renderer/WindowProperties.h"
@@ -23,14 +27,19 @@ namespace MRG::Vulkan
 		VkSurfaceKHR surface{};
 		VkPhysicalDevice physicalDevice = VK_NULL_HANDLE;
 		VkDevice device{};
-		Queue graphicsQueue{}, presentQueue{};
+		MemoryAllocator allocator;
+		Queue graphicsQueue{}, presentQueue{}, transferQueue{};
+		UploadContext uploadContext;
 		SwapChain swapChain;
 		VkDescriptorSetLayout descriptorSetLayout{};
-		Pipeline clearingPipeline;
+		bool supportsTextureTable = false;
+		TextureTable textureTable;
+		PipelineCache pipelineCache;
 		Pipeline renderingPipeline;
 		VkRenderPass ImGuiRenderPass{};
 		VkCommandPool commandPool{};
-		std::vector<std::array<VkCommandBuffer, 3>> commandBuffers;
+		// One per frame in flight, every pass of a frame being recorded in the same command buffer
+		std::vector<VkCommandBuffer> commandBuffers;
 		std::size_t currentFrame = 0;
 		VkPushConstantRange pushConstantRanges{};
 		VkDescriptorPool ImGuiPool{};
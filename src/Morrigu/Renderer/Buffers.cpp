@@ -1,5 +1,6 @@
 #include "Buffers.h"
 
+#include "Renderer/APIs/Null/Buffers.h"
 #include "Renderer/APIs/OpenGL/Buffers.h"
 #include "Renderer/APIs/Vulkan/Buffers.h"
 #include "Renderer/RenderingAPI.h"
@@ -17,6 +18,14 @@ namespace MRG
 			return createRef<Vulkan::VertexBuffer>(size);
 		}
 
+		case RenderingAPI::API::Null: {
+			return createRef<Null::VertexBuffer>(size);
+		}
+
+		case RenderingAPI::API::Software: {
+			return createRef<Null::VertexBuffer>(size);
+		}
+
 		case RenderingAPI::API::None:
 		default: {
 			MRG_CORE_ASSERT(false, fmt::format("UNSUPPORTED RENDERER API OPTION! ({})", RenderingAPI::getAPI()))
@@ -36,6 +45,14 @@ namespace MRG
 			return createRef<Vulkan::VertexBuffer>(vertices, size);
 		}
 
+		case RenderingAPI::API::Null: {
+			return createRef<Null::VertexBuffer>(vertices, size);
+		}
+
+		case RenderingAPI::API::Software: {
+			return createRef<Null::VertexBuffer>(vertices, size);
+		}
+
 		case RenderingAPI::API::None:
 		default: {
 			MRG_CORE_ASSERT(false, fmt::format("UNSUPPORTED RENDERER API OPTION! ({})", RenderingAPI::getAPI()))
@@ -55,6 +72,14 @@ namespace MRG
 			return createRef<Vulkan::IndexBuffer>(indices, count);
 		}
 
+		case RenderingAPI::API::Null: {
+			return createRef<Null::IndexBuffer>(indices, count);
+		}
+
+		case RenderingAPI::API::Software: {
+			return createRef<Null::IndexBuffer>(indices, count);
+		}
+
 		case RenderingAPI::API::None:
 		default: {
 			MRG_CORE_ASSERT(false, fmt::format("UNSUPPORTED RENDERER API OPTION! ({})", RenderingAPI::getAPI()))
@@ -143,6 +143,8 @@ namespace MRG
 		virtual void setData(const void* data, uint32_t size) = 0;
 
 		BufferLayout layout;
+		// Per instance buffers are advanced once per drawn instance instead of once per vertex.
+		bool perInstance = false;
 
 		[[nodiscard]] static Ref<VertexBuffer> create(uint32_t size);
 		[[nodiscard]] static Ref<VertexBuffer> create(const void* vertices, uint32_t size);
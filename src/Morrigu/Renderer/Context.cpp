@@ -1,5 +1,6 @@
 #include "Context.h"
 
+#include "Renderer/APIs/Null/Context.h"
 #include "Renderer/APIs/OpenGL/Context.h"
 #include "Renderer/APIs/Vulkan/Context.h"
 #include "Renderer/RenderingAPI.h"
@@ -17,6 +18,14 @@ namespace MRG
 			return createScope<Vulkan::Context>(window);
 		}
 
+		case RenderingAPI::API::Null: {
+			return createScope<Null::Context>();
+		}
+
+		case RenderingAPI::API::Software: {
+			return createScope<Null::Context>();
+		}
+
 		case RenderingAPI::API::None:
 		default: {
 			MRG_CORE_ASSERT(false, fmt::format("UNSUPPORTED RENDERER API OPTION! ({})", RenderingAPI::getAPI()))
@@ -1,6 +1,8 @@
 #include "Framebuffer.h"
 
+#include "Renderer/APIs/Null/Framebuffer.h"
 #include "Renderer/APIs/OpenGL/Framebuffer.h"
+#include "Renderer/APIs/Software/Framebuffer.h"
 #include "Renderer/APIs/Vulkan/Framebuffer.h"
 
 namespace MRG
@@ -16,6 +18,14 @@ namespace MRG
 			return createRef<Vulkan::Framebuffer>(spec);
 		}
 
+		case RenderingAPI::API::Null: {
+			return createRef<Null::Framebuffer>(spec);
+		}
+
+		case RenderingAPI::API::Software: {
+			return createRef<Software::Framebuffer>(spec);
+		}
+
 		case RenderingAPI::API::None:
 		default: {
 			MRG_CORE_ASSERT(false, fmt::format("UNSUPPORTED RENDERER API OPTION! ({})", RenderingAPI::getAPI()))
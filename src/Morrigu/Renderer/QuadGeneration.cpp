@@ -0,0 +1,261 @@
+#include "QuadGeneration.h"
+
+#include "Debug/Instrumentor.h"
+
+#include <array>
+#include <cstdint>
+#include <cstring>
+
+#if defined(__x86_64__) || defined(_M_X64)
+#define MRG_QUADGENERATION_X86
+#include <immintrin.h>
+#ifdef _MSC_VER
+#include <intrin.h>
+// MSVC lets any function use any instruction set
+#define MRG_TARGET(instructionSet)
+#else
+#define MRG_TARGET(instructionSet) __attribute__((target(instructionSet)))
+#endif
+#endif
+
+namespace
+{
+	// The unit quad corners, in the same order as Generic2DRenderer::m_quadVertexPositions and m_textureCoordinates
+	constexpr std::array<float, 4> cornersX = {-0.5f, 0.5f, 0.5f, -0.5f};
+	constexpr std::array<float, 4> cornersY = {-0.5f, -0.5f, 0.5f, 0.5f};
+	constexpr std::array<float, 4> texCoordsU = {0.f, 1.f, 1.f, 0.f};
+	constexpr std::array<float, 4> texCoordsV = {0.f, 0.f, 1.f, 1.f};
+
+	static_assert(sizeof(MRG::QuadVertex) == 12 * sizeof(float), "The SIMD kernels expect QuadVertex to be made of 3 16 bytes chunks");
+
+	void generateScalar(const glm::mat4* transforms,
+	                    const glm::vec4* colors,
+	                    const uint32_t* objectIDs,
+	                    std::size_t count,
+	                    float texIndex,
+	                    float tilingFactor,
+	                    MRG::QuadVertex* destination)
+	{
+		for (std::size_t quad = 0; quad < count; ++quad) {
+			const auto& transform = transforms[quad];
+			const auto objectID = (objectIDs != nullptr) ? objectIDs[quad] : 0;
+			for (std::size_t i = 0; i < 4; ++i) {
+				destination->position = glm::vec3{transform[3] + cornersX[i] * transform[0] + cornersY[i] * transform[1]};
+				destination->color = colors[quad];
+				destination->texCoord = {texCoordsU[i], texCoordsV[i]};
+				destination->texIndex = texIndex;
+				destination->tilingFactor = tilingFactor;
+				destination->objectID = objectID;
+				++destination;
+			}
+		}
+	}
+
+#ifdef MRG_QUADGENERATION_X86
+	// Builds the 3 chunks of a vertex: (px, py, pz, r), (g, b, a, u), (v, texIndex, tilingFactor, objectID)
+	MRG_TARGET("sse4.1")
+	inline void buildVertexChunks(__m128 position, __m128 color, __m128 texCoord, __m128 tail, __m128* chunks)
+	{
+		chunks[0] = _mm_insert_ps(position, color, 0x30);
+		chunks[1] = _mm_insert_ps(_mm_castsi128_ps(_mm_srli_si128(_mm_castps_si128(color), 4)), texCoord, 0x30);
+		chunks[2] = _mm_insert_ps(tail, texCoord, 0x40);
+	}
+
+	MRG_TARGET("sse4.1")
+	void generateSSE41(const glm::mat4* transforms,
+	                   const glm::vec4* colors,
+	                   const uint32_t* objectIDs,
+	                   std::size_t count,
+	                   float texIndex,
+	                   float tilingFactor,
+	                   MRG::QuadVertex* destination,
+	                   bool streaming)
+	{
+		auto output = reinterpret_cast<float*>(destination);
+		for (std::size_t quad = 0; quad < count; ++quad) {
+			const auto matrix = glm::value_ptr(transforms[quad]);
+			const auto column0 = _mm_loadu_ps(matrix);
+			const auto column1 = _mm_loadu_ps(matrix + 4);
+			const auto column3 = _mm_loadu_ps(matrix + 12);
+			const auto color = _mm_loadu_ps(glm::value_ptr(colors[quad]));
+
+			float objectID = 0.f;
+			if (objectIDs != nullptr) {
+				std::memcpy(&objectID, &objectIDs[quad], sizeof(objectID));
+			}
+			const auto tail = _mm_set_ps(objectID, tilingFactor, texIndex, 0.f);
+
+			for (std::size_t i = 0; i < 4; ++i) {
+				const auto position = _mm_add_ps(column3,
+				                                 _mm_add_ps(_mm_mul_ps(_mm_set1_ps(cornersX[i]), column0),
+				                                            _mm_mul_ps(_mm_set1_ps(cornersY[i]), column1)));
+				const auto texCoord = _mm_set_ps(0.f, 0.f, texCoordsV[i], texCoordsU[i]);
+
+				__m128 chunks[3];
+				buildVertexChunks(position, color, texCoord, tail, chunks);
+				for (const auto& chunk : chunks) {
+					if (streaming) {
+						_mm_stream_ps(output, chunk);
+					} else {
+						_mm_storeu_ps(output, chunk);
+					}
+					output += 4;
+				}
+			}
+		}
+
+		if (streaming) {
+			_mm_sfence();
+		}
+	}
+
+	// Processes vertices two by two: a pair of vertices is 96 bytes, or 3 AVX registers.
+	// Only called on 32 bytes aligned destinations, which makes every vertex pair aligned as well.
+	MRG_TARGET("avx2")
+	void generateAVX2(const glm::mat4* transforms,
+	                  const glm::vec4* colors,
+	                  const uint32_t* objectIDs,
+	                  std::size_t count,
+	                  float texIndex,
+	                  float tilingFactor,
+	                  MRG::QuadVertex* destination)
+	{
+		// Plain arrays, as vector types lose their attributes when used as template arguments
+		const __m256 pairCornersX[2] = {_mm256_setr_m128(_mm_set1_ps(cornersX[0]), _mm_set1_ps(cornersX[1])),
+		                                _mm256_setr_m128(_mm_set1_ps(cornersX[2]), _mm_set1_ps(cornersX[3]))};
+		const __m256 pairCornersY[2] = {_mm256_setr_m128(_mm_set1_ps(cornersY[0]), _mm_set1_ps(cornersY[1])),
+		                                _mm256_setr_m128(_mm_set1_ps(cornersY[2]), _mm_set1_ps(cornersY[3]))};
+
+		auto output = reinterpret_cast<float*>(destination);
+		for (std::size_t quad = 0; quad < count; ++quad) {
+			const auto matrix = glm::value_ptr(transforms[quad]);
+			// glm matrices are not 16 bytes aligned, so no _mm256_broadcast_ps here
+			const auto column0 = _mm256_setr_m128(_mm_loadu_ps(matrix), _mm_loadu_ps(matrix));
+			const auto column1 = _mm256_setr_m128(_mm_loadu_ps(matrix + 4), _mm_loadu_ps(matrix + 4));
+			const auto column3 = _mm256_setr_m128(_mm_loadu_ps(matrix + 12), _mm_loadu_ps(matrix + 12));
+			const auto color = _mm_loadu_ps(glm::value_ptr(colors[quad]));
+
+			float objectID = 0.f;
+			if (objectIDs != nullptr) {
+				std::memcpy(&objectID, &objectIDs[quad], sizeof(objectID));
+			}
+			const auto tail = _mm_set_ps(objectID, tilingFactor, texIndex, 0.f);
+
+			for (std::size_t pair = 0; pair < 2; ++pair) {
+				const auto positions = _mm256_add_ps(
+				  column3, _mm256_add_ps(_mm256_mul_ps(pairCornersX[pair], column0), _mm256_mul_ps(pairCornersY[pair], column1)));
+
+				__m128 chunks[6];
+				for (std::size_t i = 0; i < 2; ++i) {
+					const auto vertex = pair * 2 + i;
+					const auto position = (i == 0) ? _mm256_castps256_ps128(positions) : _mm256_extractf128_ps(positions, 1);
+					const auto texCoord = _mm_set_ps(0.f, 0.f, texCoordsV[vertex], texCoordsU[vertex]);
+					buildVertexChunks(position, color, texCoord, tail, &chunks[i * 3]);
+				}
+
+				_mm256_stream_ps(output, _mm256_setr_m128(chunks[0], chunks[1]));
+				_mm256_stream_ps(output + 8, _mm256_setr_m128(chunks[2], chunks[3]));
+				_mm256_stream_ps(output + 16, _mm256_setr_m128(chunks[4], chunks[5]));
+				output += 24;
+			}
+		}
+
+		_mm_sfence();
+	}
+#endif
+}  // namespace
+
+namespace MRG::QuadGeneration
+{
+	SIMDLevel getSIMDLevel()
+	{
+		static const auto level = []() {
+#ifdef MRG_QUADGENERATION_X86
+#ifdef _MSC_VER
+			std::array<int, 4> registers{};
+			__cpuid(registers.data(), 1);
+			const auto hasSSE41 = (registers[2] & (1 << 19)) != 0;
+			const auto hasOSXSAVE = (registers[2] & (1 << 27)) != 0;
+			const auto hasAVX = (registers[2] & (1 << 28)) != 0;
+			// The OS must also save the AVX registers on context switches
+			const auto avxEnabled = hasOSXSAVE && hasAVX && (_xgetbv(0) & 0x6) == 0x6;
+			__cpuidex(registers.data(), 7, 0);
+			const auto hasAVX2 = avxEnabled && (registers[1] & (1 << 5)) != 0;
+#else
+			__builtin_cpu_init();
+			const auto hasSSE41 = __builtin_cpu_supports("sse4.1") != 0;
+			const auto hasAVX2 = __builtin_cpu_supports("avx2") != 0;
+#endif
+			if (hasAVX2) {
+				return SIMDLevel::AVX2;
+			}
+			if (hasSSE41) {
+				return SIMDLevel::SSE41;
+			}
+#endif
+			return SIMDLevel::Scalar;
+		}();
+
+		return level;
+	}
+
+	void generateVertices(const glm::mat4* transforms,
+	                      const glm::vec4* colors,
+	                      const uint32_t* objectIDs,
+	                      std::size_t count,
+	                      float texIndex,
+	                      float tilingFactor,
+	                      QuadVertex* destination)
+	{
+		MRG_PROFILE_FUNCTION()
+
+#ifdef MRG_QUADGENERATION_X86
+		const auto address = reinterpret_cast<std::uintptr_t>(destination);
+		switch (getSIMDLevel()) {
+		case SIMDLevel::AVX2: {
+			if (address % 32 == 0) {
+				generateAVX2(transforms, colors, objectIDs, count, texIndex, tilingFactor, destination);
+				return;
+			}
+			generateSSE41(transforms, colors, objectIDs, count, texIndex, tilingFactor, destination, address % 16 == 0);
+			return;
+		}
+
+		case SIMDLevel::SSE41: {
+			generateSSE41(transforms, colors, objectIDs, count, texIndex, tilingFactor, destination, address % 16 == 0);
+			return;
+		}
+
+		case SIMDLevel::Scalar:
+		default:
+			break;
+		}
+#endif
+
+		generateScalar(transforms, colors, objectIDs, count, texIndex, tilingFactor, destination);
+	}
+
+	void generateInstances(const glm::mat4* transforms,
+	                       const glm::vec4* colors,
+	                       const uint32_t* objectIDs,
+	                       std::size_t count,
+	                       float texIndex,
+	                       float tilingFactor,
+	                       QuadInstance* destination)
+	{
+		MRG_PROFILE_FUNCTION()
+
+		for (std::size_t quad = 0; quad < count; ++quad) {
+			const auto& transform = transforms[quad];
+			destination->transformX = glm::vec3{transform[0]};
+			destination->transformY = glm::vec3{transform[1]};
+			destination->translation = glm::vec3{transform[3]};
+			destination->color = colors[quad];
+			destination->texRect = {0.f, 0.f, 1.f, 1.f};
+			destination->texIndex = texIndex;
+			destination->tilingFactor = tilingFactor;
+			destination->objectID = (objectIDs != nullptr) ? objectIDs[quad] : 0;
+			++destination;
+		}
+	}
+}  // namespace MRG::QuadGeneration
@@ -0,0 +1,41 @@
+#ifndef MRG_HELPER_QUADGENERATION
+#define MRG_HELPER_QUADGENERATION
+
+#include "Renderer/Renderer2D.h"
+
+#include <cstddef>
+
+namespace MRG::QuadGeneration
+{
+	enum class SIMDLevel
+	{
+		Scalar = 0,
+		SSE41,
+		AVX2
+	};
+
+	// Best instruction set supported by the CPU, detected once at the first call
+	[[nodiscard]] SIMDLevel getSIMDLevel();
+
+	// Writes the 4 vertices of each quad in destination, using the whole texture. Quads are described as separate streams of
+	// transforms, colors and object IDs (objectIDs may be null). The widest kernel supported by both the CPU and the alignment of
+	// destination is used, and non-temporal stores are used whenever possible since the destination is usually mapped GPU memory.
+	void generateVertices(const glm::mat4* transforms,
+	                      const glm::vec4* colors,
+	                      const uint32_t* objectIDs,
+	                      std::size_t count,
+	                      float texIndex,
+	                      float tilingFactor,
+	                      QuadVertex* destination);
+
+	// Instanced rendering counterpart of generateVertices, writing a single QuadInstance per quad
+	void generateInstances(const glm::mat4* transforms,
+	                       const glm::vec4* colors,
+	                       const uint32_t* objectIDs,
+	                       std::size_t count,
+	                       float texIndex,
+	                       float tilingFactor,
+	                       QuadInstance* destination);
+}  // namespace MRG::QuadGeneration
+
+#endif
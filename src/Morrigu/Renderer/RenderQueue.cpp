@@ -0,0 +1,95 @@
+#include "RenderQueue.h"
+
+#include "Debug/Instrumentor.h"
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <utility>
+
+namespace MRG
+{
+	uint64_t RenderQueue::makeKey(uint8_t layer, float depth, uint8_t pipeline, uint32_t textureIndex)
+	{
+		const auto quantizedDepth = static_cast<uint64_t>((1.f - std::clamp(depth, 0.f, 1.f)) * 0xFFFFFF);
+		const auto textureID = static_cast<uint64_t>(std::min(textureIndex, 0xFFFFFFu));
+
+		return (static_cast<uint64_t>(layer) << 56) | (quantizedDepth << 32) | (static_cast<uint64_t>(pipeline) << 24) | textureID;
+	}
+
+	uint32_t RenderQueue::registerTexture(const Ref<Texture2D>& texture)
+	{
+		if (texture == nullptr) {
+			return noTexture;
+		}
+
+		const auto [it, inserted] = m_textureIndices.try_emplace(texture.get(), static_cast<uint32_t>(m_textures.size()));
+		if (inserted) {
+			m_textures.push_back(texture);
+		}
+		return it->second;
+	}
+
+	uint32_t RenderQueue::registerSubTexture(const Ref<SubTexture2D>& subTexture)
+	{
+		if (subTexture == nullptr) {
+			return noTexture;
+		}
+
+		const auto [it, inserted] = m_subTextureIndices.try_emplace(subTexture.get(), static_cast<uint32_t>(m_subTextures.size()));
+		if (inserted) {
+			m_subTextures.push_back(subTexture);
+		}
+		return it->second;
+	}
+
+	void RenderQueue::reserve(std::size_t additionalCount)
+	{
+		// Reserving the exact size every time would defeat the geometric growth of the vectors
+		const auto requiredCount = m_commands.size() + additionalCount;
+		if (requiredCount > m_commands.capacity()) {
+			const auto newCapacity = std::max(requiredCount, 2 * m_commands.capacity());
+			m_entries.reserve(newCapacity);
+			m_commands.reserve(newCapacity);
+		}
+	}
+
+	void RenderQueue::push(uint64_t key, const Command& command)
+	{
+		m_entries.push_back({key, static_cast<uint32_t>(m_commands.size())});
+		m_commands.push_back(command);
+	}
+
+	void RenderQueue::sort()
+	{
+		MRG_PROFILE_FUNCTION()
+
+		// LSD radix sort on 8 bits digits. It is stable, which keeps submission order for identical keys.
+		m_sortBuffer.resize(m_entries.size());
+		for (uint32_t shift = 0; shift < 64; shift += 8) {
+			std::array<std::size_t, 256> offsets{};
+			for (const auto& entry : m_entries) { ++offsets[(entry.key >> shift) & 0xFF]; }
+
+			// Every key shares this digit (typically the layer or the pipeline), so the pass would not change anything
+			if (std::any_of(offsets.begin(), offsets.end(), [this](std::size_t count) { return count == m_entries.size(); })) {
+				continue;
+			}
+
+			std::size_t total = 0;
+			for (auto& offset : offsets) { total += std::exchange(offset, total); }
+
+			for (const auto& entry : m_entries) { m_sortBuffer[offsets[(entry.key >> shift) & 0xFF]++] = entry; }
+			std::swap(m_entries, m_sortBuffer);
+		}
+	}
+
+	void RenderQueue::clear()
+	{
+		m_entries.clear();
+		m_commands.clear();
+		m_textures.clear();
+		m_subTextures.clear();
+		m_textureIndices.clear();
+		m_subTextureIndices.clear();
+	}
+}  // namespace MRG
@@ -0,0 +1,71 @@
+#ifndef MRG_CLASS_RENDERQUEUE
+#define MRG_CLASS_RENDERQUEUE
+
+#include "Core/GLMIncludeHelper.h"
+#include "Renderer/SubTexture2D.h"
+#include "Renderer/Textures.h"
+
+#include <unordered_map>
+#include <vector>
+
+namespace MRG
+{
+	// Quads submitted in deferred mode are stored here with a 64 bits sort key, and replayed in key order at the end of the scene.
+	// Key layout, from the most significant bits: layer (8) | depth (24, far to near) | pipeline (8) | texture (24).
+	class RenderQueue
+	{
+	public:
+		static const uint32_t noTexture = UINT32_MAX;
+
+		// Textures are only referenced by their index in the queue, so that queuing a quad never touches a reference count
+		struct Command
+		{
+			glm::mat4 transform;
+			glm::vec4 color;
+			float tilingFactor;
+			uint32_t objectID;
+			uint32_t textureIndex;
+			uint32_t subTextureIndex;
+		};
+
+		// depth is expected in [0, 1], 0 being the near plane. textureIndex comes from registerTexture, untextured quads sorting last.
+		[[nodiscard]] static uint64_t makeKey(uint8_t layer, float depth, uint8_t pipeline, uint32_t textureIndex);
+
+		// Keeps the texture alive until the queue is cleared, and returns the same index for every registration of a texture
+		[[nodiscard]] uint32_t registerTexture(const Ref<Texture2D>& texture);
+		[[nodiscard]] uint32_t registerSubTexture(const Ref<SubTexture2D>& subTexture);
+		[[nodiscard]] const Ref<Texture2D>& getTexture(uint32_t index) const { return m_textures[index]; }
+		[[nodiscard]] const Ref<SubTexture2D>& getSubTexture(uint32_t index) const { return m_subTextures[index]; }
+
+		// Clearing the queue keeps its capacity, so this only allocates when a frame queues more quads than the previous ones
+		void reserve(std::size_t additionalCount);
+		void push(uint64_t key, const Command& command);
+		void sort();
+		void clear();
+
+		[[nodiscard]] bool empty() const { return m_entries.empty(); }
+		[[nodiscard]] std::size_t size() const { return m_entries.size(); }
+
+		// Only valid after sort() has been called
+		template<typename Func>
+		void forEach(Func&& func) const
+		{
+			for (const auto& entry : m_entries) { func(m_commands[entry.commandIndex]); }
+		}
+
+	private:
+		struct Entry
+		{
+			uint64_t key;
+			uint32_t commandIndex;
+		};
+
+		std::vector<Entry> m_entries, m_sortBuffer;
+		std::vector<Command> m_commands;
+		std::vector<Ref<Texture2D>> m_textures;
+		std::vector<Ref<SubTexture2D>> m_subTextures;
+		std::unordered_map<const void*, uint32_t> m_textureIndices, m_subTextureIndices;
+	};
+}  // namespace MRG
+
+#endif
@@ -1,17 +1,230 @@
 #include "Renderer2D.h"
 
 #include "Debug/Instrumentor.h"
+#include "Renderer/QuadGeneration.h"
+#include "Renderer/APIs/Null/Renderer2D.h"
 #include "Renderer/APIs/OpenGL/Renderer2D.h"
+#include "Renderer/APIs/Software/Renderer2D.h"
 #include "Renderer/APIs/Vulkan/Renderer2D.h"
 
+#include <algorithm>
 #include <utility>
 
 namespace MRG
 {
+	void Generic2DRenderer::writeQuad(
+	  const glm::mat4& transform, const glm::vec4& color, float texIndex, float tilingFactor, uint32_t objectID)
+	{
+		writeQuad(transform, color, texIndex, tilingFactor, objectID, m_textureCoordinates);
+	}
+
+	void Generic2DRenderer::writeQuad(const glm::mat4& transform,
+	                                  const glm::vec4& color,
+	                                  float texIndex,
+	                                  float tilingFactor,
+	                                  uint32_t objectID,
+	                                  const std::array<glm::vec2, 4>& texCoords)
+	{
+		if (m_renderingMode == QuadRenderingMode::Instanced) {
+			m_qibPtr->transformX = glm::vec3{transform[0]};
+			m_qibPtr->transformY = glm::vec3{transform[1]};
+			m_qibPtr->translation = glm::vec3{transform[3]};
+			m_qibPtr->color = color;
+			m_qibPtr->texRect = {texCoords[0], texCoords[2] - texCoords[0]};
+			m_qibPtr->texIndex = texIndex;
+			m_qibPtr->tilingFactor = tilingFactor;
+			m_qibPtr->objectID = objectID;
+			++m_qibPtr;
+
+			return;
+		}
+
+		for (std::size_t i = 0; i < m_quadVertexCount; ++i) {
+			m_qvbPtr->position = transform * m_quadVertexPositions[i];
+			m_qvbPtr->color = color;
+			m_qvbPtr->texCoord = texCoords[i];
+			m_qvbPtr->texIndex = texIndex;
+			m_qvbPtr->tilingFactor = tilingFactor;
+			m_qvbPtr->objectID = objectID;
+			++m_qvbPtr;
+		}
+	}
+
+	void Generic2DRenderer::writeQuads(const glm::mat4* transforms,
+	                                   const glm::vec4* colors,
+	                                   const uint32_t* objectIDs,
+	                                   std::size_t count,
+	                                   float texIndex,
+	                                   float tilingFactor)
+	{
+		if (m_renderingMode == QuadRenderingMode::Instanced) {
+			QuadGeneration::generateInstances(transforms, colors, objectIDs, count, texIndex, tilingFactor, m_qibPtr);
+			m_qibPtr += count;
+			return;
+		}
+
+		QuadGeneration::generateVertices(transforms, colors, objectIDs, count, texIndex, tilingFactor, m_qvbPtr);
+		m_qvbPtr += count * m_quadVertexCount;
+	}
+
+	void Generic2DRenderer::drawQuad(const glm::mat4& transform, const glm::vec4& color, uint32_t objectID)
+	{
+		const float texIndex = 0.0f;
+		const float tilingFactor = 1.0f;
+
+		if (m_quadIndexCount >= maxIndices) {
+			flushAndReset();
+		}
+
+		writeQuad(transform, color, texIndex, tilingFactor, objectID);
+
+		m_quadIndexCount += 6;
+		++m_stats.quadCount;
+	}
+
+	void
+	Generic2DRenderer::drawQuad(const glm::mat4& transform, const Ref<Texture2D>& texture, float tilingFactor, const glm::vec4& tintColor)
+	{
+		if (m_quadIndexCount >= maxIndices) {
+			flushAndReset();
+		}
+
+		const auto texIndex = getTextureIndex(texture);
+		writeQuad(transform, tintColor, texIndex, tilingFactor, 0);
+
+		m_quadIndexCount += 6;
+		++m_stats.quadCount;
+	}
+
+	void Generic2DRenderer::drawQuad(const glm::mat4& transform,
+	                                 const Ref<SubTexture2D>& subTexture,
+	                                 float tilingFactor,
+	                                 const glm::vec4& tintColor)
+	{
+		if (m_quadIndexCount >= maxIndices) {
+			flushAndReset();
+		}
+
+		const auto texIndex = getTextureIndex(subTexture->getTexture());
+		writeQuad(transform, tintColor, texIndex, tilingFactor, 0, subTexture->getTexCoords());
+
+		m_quadIndexCount += 6;
+		++m_stats.quadCount;
+	}
+
+	void Generic2DRenderer::drawQuads(Span<const glm::mat4> transforms, Span<const glm::vec4> colors, Span<const uint32_t> objectIDs)
+	{
+		MRG_PROFILE_FUNCTION()
+
+		submitQuads(transforms, nullptr, 1.f, colors, objectIDs);
+	}
+
+	void Generic2DRenderer::drawQuads(Span<const glm::mat4> transforms,
+	                                  const Ref<Texture2D>& texture,
+	                                  float tilingFactor,
+	                                  Span<const glm::vec4> tintColors,
+	                                  Span<const uint32_t> objectIDs)
+	{
+		MRG_PROFILE_FUNCTION()
+
+		submitQuads(transforms, texture, tilingFactor, tintColors, objectIDs);
+	}
+
+	void Generic2DRenderer::drawQuad(const glm::vec3& position, const glm::vec2& size, const glm::vec4& color)
+	{
+		auto transform = glm::translate(glm::mat4{1.f}, position) * glm::scale(glm::mat4{1.f}, {size.x, size.y, 1.f});
+
+		drawQuad(transform, color, 0);
+	}
+
+	void Generic2DRenderer::drawQuad(
+	  const glm::vec3& position, const glm::vec2& size, const Ref<Texture2D>& texture, float tilingFactor, const glm::vec4& tintColor)
+	{
+		auto transform = glm::translate(glm::mat4{1.f}, position) * glm::scale(glm::mat4{1.f}, {size.x, size.y, 1.f});
+
+		drawQuad(transform, texture, tilingFactor, tintColor);
+	}
+
+	void Generic2DRenderer::drawRotatedQuad(const glm::vec3& position, const glm::vec2& size, float rotation, const glm::vec4& color)
+	{
+		auto transform = glm::translate(glm::mat4{1.f}, position) * glm::scale(glm::mat4{1.f}, {size.x, size.y, 1.f}) *
+		                 glm::rotate(glm::mat4{1.f}, rotation, {0.f, 0.f, 1.f});
+
+		// TODO: This will completely break, but we're not exposing this for now. Fix it before everything breaks please.
+		drawQuad(transform, color, 0);
+	}
+
+	void Generic2DRenderer::drawRotatedQuad(const glm::vec3& position,
+	                                        const glm::vec2& size,
+	                                        float rotation,
+	                                        const Ref<Texture2D>& texture,
+	                                        float tilingFactor,
+	                                        const glm::vec4& tintColor)
+	{
+		auto transform = glm::translate(glm::mat4{1.f}, position) * glm::scale(glm::mat4{1.f}, {size.x, size.y, 1.f}) *
+		                 glm::rotate(glm::mat4{1.f}, rotation, {0.f, 0.f, 1.f});
+
+		// TODO: This will completely break, but we're not exposing this for now. Fix it before everything breaks please.
+		drawQuad(transform, texture, tilingFactor, tintColor);
+	}
+
+	float Generic2DRenderer::getTextureIndex(const Ref<Texture2D>& texture)
+	{
+		for (uint32_t i = 0; i < m_textureSlotindex; ++i) {
+			if (*m_textureSlots[i] == *texture) {
+				return static_cast<float>(i);
+			}
+		}
+
+		if (m_textureSlotindex >= maxTextureSlots) {
+			flushAndReset();
+		}
+
+		const auto texIndex = static_cast<float>(m_textureSlotindex);
+		m_textureSlots[m_textureSlotindex] = texture;
+		++m_textureSlotindex;
+
+		return texIndex;
+	}
+
+	void Generic2DRenderer::submitQuads(Span<const glm::mat4> transforms,
+	                                    const Ref<Texture2D>& texture,
+	                                    float tilingFactor,
+	                                    Span<const glm::vec4> colors,
+	                                    Span<const uint32_t> objectIDs)
+	{
+		std::size_t offset = 0;
+		while (offset < transforms.size()) {
+			if (m_quadIndexCount >= maxIndices) {
+				flushAndReset();
+			}
+
+			// Looked up again for every batch, as flushing frees the texture slots
+			const auto texIndex = (texture != nullptr) ? getTextureIndex(texture) : 0.f;
+			const auto batchSize = std::min<std::size_t>(transforms.size() - offset, (maxIndices - m_quadIndexCount) / 6);
+			writeQuads(transforms.data() + offset,
+			           colors.data() + offset,
+			           objectIDs.empty() ? nullptr : objectIDs.data() + offset,
+			           batchSize,
+			           texIndex,
+			           tilingFactor);
+
+			m_quadIndexCount += static_cast<uint32_t>(batchSize * 6);
+			m_stats.quadCount += static_cast<uint32_t>(batchSize);
+			offset += batchSize;
+		}
+	}
+
 	GLFWwindow* Renderer2D::s_windowHandle;
 	Scope<Generic2DRenderer> Renderer2D::s_renderer;
 
-	void Renderer2D::init(GLFWwindow* window)
+	QuadSubmissionMode Renderer2D::s_submissionMode = QuadSubmissionMode::Immediate;
+	RenderQueue Renderer2D::s_renderQueue;
+	glm::mat4 Renderer2D::s_viewProjection{1.f};
+	uint8_t Renderer2D::s_sortLayer = 0;
+	uint32_t Renderer2D::s_culledQuadCount = 0;
+
+	void Renderer2D::init(GLFWwindow* window, QuadRenderingMode mode)
 	{
 		MRG_PROFILE_FUNCTION()
 
@@ -26,10 +239,19 @@ namespace MRG
 			s_renderer = createScope<Vulkan::Renderer2D>();
 		} break;
 
+		case RenderingAPI::API::Null: {
+			s_renderer = createScope<Null::Renderer2D>();
+		} break;
+
+		case RenderingAPI::API::Software: {
+			s_renderer = createScope<Software::Renderer2D>();
+		} break;
+
 		default:
 			break;
 		}
 
+		s_renderer->m_renderingMode = mode;
 		s_renderer->init();
 	}
 
@@ -37,6 +259,7 @@ namespace MRG
 	{
 		MRG_PROFILE_FUNCTION()
 
+		s_renderQueue.clear();
 		s_renderer->shutdown();
 	}
 
@@ -65,6 +288,7 @@ namespace MRG
 	{
 		MRG_PROFILE_FUNCTION()
 
+		s_viewProjection = camera.getProjection() * glm::inverse(transform);
 		s_renderer->beginScene(camera, transform);
 	}
 
@@ -72,6 +296,7 @@ namespace MRG
 	{
 		MRG_PROFILE_FUNCTION()
 
+		s_viewProjection = camera.getViewProjection();
 		s_renderer->beginScene(camera);
 	}
 
@@ -79,13 +304,25 @@ namespace MRG
 	{
 		MRG_PROFILE_FUNCTION()
 
+		flushQueue();
 		s_renderer->endScene();
 	}
 
+	void Renderer2D::setQuadSubmissionMode(QuadSubmissionMode mode)
+	{
+		flushQueue();
+		s_submissionMode = mode;
+	}
+
 	void Renderer2D::drawQuad(const glm::mat4& transform, const glm::vec4& color, uint32_t objectID)
 	{
 		MRG_PROFILE_FUNCTION()
 
+		if (s_submissionMode == QuadSubmissionMode::Deferred) {
+			enqueueQuad(transform, color, RenderQueue::noTexture, RenderQueue::noTexture, 1.f, objectID);
+			return;
+		}
+
 		s_renderer->drawQuad(transform, color, objectID);
 	}
 
@@ -93,9 +330,89 @@ namespace MRG
 	{
 		MRG_PROFILE_FUNCTION()
 
+		if (s_submissionMode == QuadSubmissionMode::Deferred) {
+			enqueueQuad(transform, tintColor, s_renderQueue.registerTexture(texture), RenderQueue::noTexture, tilingFactor, 0);
+			return;
+		}
+
 		s_renderer->drawQuad(transform, texture, tilingFactor, tintColor);
 	}
 
+	void Renderer2D::drawQuad(
+	  const glm::vec2& position, const glm::vec2& size, const Ref<SubTexture2D>& subTexture, float tilingFactor, const glm::vec4& tintColor)
+	{
+		drawQuad(glm::vec3(position, 0.0f), size, subTexture, tilingFactor, tintColor);
+	}
+
+	void Renderer2D::drawQuad(
+	  const glm::vec3& position, const glm::vec2& size, const Ref<SubTexture2D>& subTexture, float tilingFactor, const glm::vec4& tintColor)
+	{
+		const auto transform = glm::translate(glm::mat4{1.f}, position) * glm::scale(glm::mat4{1.f}, {size.x, size.y, 1.f});
+
+		drawQuad(transform, subTexture, tilingFactor, tintColor);
+	}
+
+	void Renderer2D::drawQuads(Span<const glm::mat4> transforms, Span<const glm::vec4> colors, Span<const uint32_t> objectIDs)
+	{
+		MRG_PROFILE_FUNCTION()
+
+		MRG_CORE_ASSERT(colors.size() == transforms.size(), "Every quad needs a color!")
+		MRG_CORE_ASSERT(objectIDs.empty() || objectIDs.size() == transforms.size(), "Every quad needs an object ID!")
+
+		if (s_submissionMode == QuadSubmissionMode::Deferred) {
+			s_renderQueue.reserve(transforms.size());
+			for (std::size_t i = 0; i < transforms.size(); ++i) {
+				enqueueQuad(
+				  transforms[i], colors[i], RenderQueue::noTexture, RenderQueue::noTexture, 1.f, objectIDs.empty() ? 0 : objectIDs[i]);
+			}
+			return;
+		}
+
+		s_renderer->drawQuads(transforms, colors, objectIDs);
+	}
+
+	void Renderer2D::drawQuads(Span<const glm::mat4> transforms,
+	                           const Ref<Texture2D>& texture,
+	                           float tilingFactor,
+	                           Span<const glm::vec4> tintColors,
+	                           Span<const uint32_t> objectIDs)
+	{
+		MRG_PROFILE_FUNCTION()
+
+		MRG_CORE_ASSERT(tintColors.size() == transforms.size(), "Every quad needs a tint color!")
+		MRG_CORE_ASSERT(objectIDs.empty() || objectIDs.size() == transforms.size(), "Every quad needs an object ID!")
+
+		if (s_submissionMode == QuadSubmissionMode::Deferred) {
+			s_renderQueue.reserve(transforms.size());
+			const auto textureIndex = s_renderQueue.registerTexture(texture);
+			for (std::size_t i = 0; i < transforms.size(); ++i) {
+				enqueueQuad(
+				  transforms[i], tintColors[i], textureIndex, RenderQueue::noTexture, tilingFactor, objectIDs.empty() ? 0 : objectIDs[i]);
+			}
+			return;
+		}
+
+		s_renderer->drawQuads(transforms, texture, tilingFactor, tintColors, objectIDs);
+	}
+
+	void
+	Renderer2D::drawQuad(const glm::mat4& transform, const Ref<SubTexture2D>& subTexture, float tilingFactor, const glm::vec4& tintColor)
+	{
+		MRG_PROFILE_FUNCTION()
+
+		if (s_submissionMode == QuadSubmissionMode::Deferred) {
+			enqueueQuad(transform,
+			            tintColor,
+			            s_renderQueue.registerTexture(subTexture->getTexture()),
+			            s_renderQueue.registerSubTexture(subTexture),
+			            tilingFactor,
+			            0);
+			return;
+		}
+
+		s_renderer->drawQuad(transform, subTexture, tilingFactor, tintColor);
+	}
+
 	void Renderer2D::drawQuad(const glm::vec2& position, const glm::vec2& size, const glm::vec4& color)
 	{
 		drawQuad(glm::vec3(position, 0.0f), size, color);
@@ -105,6 +422,12 @@ namespace MRG
 	{
 		MRG_PROFILE_FUNCTION()
 
+		if (s_submissionMode == QuadSubmissionMode::Deferred) {
+			const auto transform = glm::translate(glm::mat4{1.f}, position) * glm::scale(glm::mat4{1.f}, {size.x, size.y, 1.f});
+			enqueueQuad(transform, color, RenderQueue::noTexture, RenderQueue::noTexture, 1.f, 0);
+			return;
+		}
+
 		s_renderer->drawQuad(position, size, color);
 	}
 
@@ -119,6 +442,12 @@ namespace MRG
 	{
 		MRG_PROFILE_FUNCTION()
 
+		if (s_submissionMode == QuadSubmissionMode::Deferred) {
+			const auto transform = glm::translate(glm::mat4{1.f}, position) * glm::scale(glm::mat4{1.f}, {size.x, size.y, 1.f});
+			enqueueQuad(transform, tintColor, s_renderQueue.registerTexture(texture), RenderQueue::noTexture, tilingFactor, 0);
+			return;
+		}
+
 		s_renderer->drawQuad(position, size, texture, tilingFactor, tintColor);
 	}
 
@@ -131,6 +460,13 @@ namespace MRG
 	{
 		MRG_PROFILE_FUNCTION()
 
+		if (s_submissionMode == QuadSubmissionMode::Deferred) {
+			const auto transform = glm::translate(glm::mat4{1.f}, position) * glm::scale(glm::mat4{1.f}, {size.x, size.y, 1.f}) *
+			                       glm::rotate(glm::mat4{1.f}, rotation, {0.f, 0.f, 1.f});
+			enqueueQuad(transform, color, RenderQueue::noTexture, RenderQueue::noTexture, 1.f, 0);
+			return;
+		}
+
 		s_renderer->drawRotatedQuad(position, size, rotation, color);
 	}
 
@@ -153,6 +489,13 @@ namespace MRG
 	{
 		MRG_PROFILE_FUNCTION()
 
+		if (s_submissionMode == QuadSubmissionMode::Deferred) {
+			const auto transform = glm::translate(glm::mat4{1.f}, position) * glm::scale(glm::mat4{1.f}, {size.x, size.y, 1.f}) *
+			                       glm::rotate(glm::mat4{1.f}, rotation, {0.f, 0.f, 1.f});
+			enqueueQuad(transform, tintColor, s_renderQueue.registerTexture(texture), RenderQueue::noTexture, tilingFactor, 0);
+			return;
+		}
+
 		s_renderer->drawRotatedQuad(position, size, rotation, texture, tilingFactor, tintColor);
 	}
 
@@ -160,6 +503,7 @@ namespace MRG
 	{
 		MRG_PROFILE_FUNCTION()
 
+		flushQueue();
 		s_renderer->setRenderTarget(std::move(renderTarget));
 	}
 
@@ -167,6 +511,7 @@ namespace MRG
 	{
 		MRG_PROFILE_FUNCTION()
 
+		flushQueue();
 		s_renderer->resetRenderTarget();
 	}
 
@@ -198,10 +543,25 @@ namespace MRG
 		s_renderer->clear();
 	}
 
+	void Renderer2D::beginGPUPass(GPUPass pass)
+	{
+		MRG_PROFILE_FUNCTION()
+
+		s_renderer->beginGPUPass(pass);
+	}
+
+	void Renderer2D::endGPUPass()
+	{
+		MRG_PROFILE_FUNCTION()
+
+		s_renderer->endGPUPass();
+	}
+
 	void Renderer2D::resetStats()
 	{
 		MRG_PROFILE_FUNCTION()
 
+		s_culledQuadCount = 0;
 		s_renderer->resetStats();
 	}
 
@@ -209,6 +569,59 @@ namespace MRG
 	{
 		MRG_PROFILE_FUNCTION()
 
-		return s_renderer->getStats();
+		auto stats = s_renderer->getStats();
+		stats.culledQuadCount = s_culledQuadCount;
+		return stats;
+	}
+
+	void Renderer2D::setPresentationPolicy(const PresentationPolicy& policy)
+	{
+		MRG_PROFILE_FUNCTION()
+
+		s_renderer->setPresentationPolicy(policy);
+	}
+
+	PresentationPolicy Renderer2D::getPresentationPolicy() { return s_renderer->getPresentationPolicy(); }
+
+	void Renderer2D::enqueueQuad(const glm::mat4& transform,
+	                             const glm::vec4& color,
+	                             uint32_t textureIndex,
+	                             uint32_t subTextureIndex,
+	                             float tilingFactor,
+	                             uint32_t objectID)
+	{
+		const auto clipPosition = s_viewProjection * transform[3];
+		const auto depth = (clipPosition.w > 0.f) ? clipPosition.z / clipPosition.w : 1.f;
+
+		// The whole scene is drawn with a single pipeline for now
+		const auto key = RenderQueue::makeKey(s_sortLayer, depth, 0, textureIndex);
+		s_renderQueue.push(key, {transform, color, tilingFactor, objectID, textureIndex, subTextureIndex});
+	}
+
+	void Renderer2D::flushQueue()
+	{
+		MRG_PROFILE_FUNCTION()
+
+		if (s_renderQueue.empty()) {
+			return;
+		}
+
+		s_renderQueue.sort();
+		s_renderQueue.forEach([](const RenderQueue::Command& command) {
+			if (command.subTextureIndex != RenderQueue::noTexture) {
+				s_renderer->drawQuad(
+				  command.transform, s_renderQueue.getSubTexture(command.subTextureIndex), command.tilingFactor, command.color);
+			} else if (command.textureIndex != RenderQueue::noTexture) {
+				// Only the span overload carries object IDs for textured quads
+				s_renderer->drawQuads({&command.transform, 1},
+				                      s_renderQueue.getTexture(command.textureIndex),
+				                      command.tilingFactor,
+				                      {&command.color, 1},
+				                      {&command.objectID, 1});
+			} else {
+				s_renderer->drawQuad(command.transform, command.color, command.objectID);
+			}
+		});
+		s_renderQueue.clear();
 	}
 }  // namespace MRG
@@ -2,10 +2,13 @@
 #define MRG_CLASS_RENDERER2D
 
 #include "Core/GLMIncludeHelper.h"
+#include "Core/Span.h"
 #include "Renderer/Buffers.h"
 #include "Renderer/Camera.h"
 #include "Renderer/EditorCamera.h"
 #include "Renderer/Framebuffer.h"
+#include "Renderer/RenderQueue.h"
+#include "Renderer/SubTexture2D.h"
 #include "Renderer/Textures.h"
 
 #include <GLFW/glfw3.h>
@@ -14,6 +17,22 @@
 
 namespace MRG
 {
+	// Batched mode writes 4 transformed vertices per quad, instanced mode writes a single QuadInstance record per quad and lets the
+	// vertex shader expand it.
+	enum class QuadRenderingMode
+	{
+		Batched = 0,
+		Instanced
+	};
+
+	// Immediate mode forwards quads to the renderer as they are submitted. Deferred mode queues them, and submits them sorted by
+	// layer, depth (back to front) and texture at the end of the scene, to get correct blending and fewer batch breaks.
+	enum class QuadSubmissionMode
+	{
+		Immediate = 0,
+		Deferred
+	};
+
 	struct QuadVertex
 	{
 		glm::vec3 position;
@@ -35,15 +54,121 @@ namespace MRG
 		};
 	};
 
+	struct QuadInstance
+	{
+		// Only the first two columns and the translation of the transform are needed, as the unit quad lies in the z = 0 plane.
+		glm::vec3 transformX;
+		glm::vec3 transformY;
+		glm::vec3 translation;
+		glm::vec4 color;
+		glm::vec4 texRect;  // xy: UV offset, zw: UV size
+		float texIndex;
+		float tilingFactor;
+		uint32_t objectID;
+
+		static auto getLayout()
+		{
+			static std::initializer_list<MRG::BufferElement> layout = {{MRG::ShaderDataType::Float3, "a_transformX"},
+			                                                           {MRG::ShaderDataType::Float3, "a_transformY"},
+			                                                           {MRG::ShaderDataType::Float3, "a_translation"},
+			                                                           {MRG::ShaderDataType::Float4, "a_color"},
+			                                                           {MRG::ShaderDataType::Float4, "a_texRect"},
+			                                                           {MRG::ShaderDataType::Float, "a_texIndex"},
+			                                                           {MRG::ShaderDataType::Float, "a_tilingFactor"},
+			                                                           {MRG::ShaderDataType::UInt, "a_objectID"}};
+			return layout;
+		};
+	};
+
+	// The passes a frame is split into, as far as GPU timings are concerned
+	enum class GPUPass
+	{
+		Clearing = 0,
+		Scene,
+		ImGui
+	};
+
+	[[nodiscard]] inline const char* getGPUPassName(GPUPass pass)
+	{
+		switch (pass) {
+		case GPUPass::Clearing:
+			return "GPU clearing pass";
+		case GPUPass::Scene:
+			return "GPU scene pass";
+		case GPUPass::ImGui:
+			return "GPU ImGui pass";
+		}
+
+		return "GPU unknown pass";
+	}
+
+	// How frames are handed to the display. Only FIFO is supported everywhere, and replaces the modes a device doesn't support.
+	enum class PresentMode
+	{
+		FIFO = 0,     // Waits for the vertical blank, never tears
+		FIFORelaxed,  // Waits for the vertical blank unless the frame is late, in which case it tears
+		Mailbox,      // Never tears nor blocks, a new frame replacing the one waiting for the vertical blank
+		Immediate     // Presents right away, tearing
+	};
+
+	[[nodiscard]] inline const char* getPresentModeName(PresentMode mode)
+	{
+		switch (mode) {
+		case PresentMode::FIFO:
+			return "FIFO";
+		case PresentMode::FIFORelaxed:
+			return "FIFO relaxed";
+		case PresentMode::Mailbox:
+			return "Mailbox";
+		case PresentMode::Immediate:
+			return "Immediate";
+		}
+
+		return "Unknown";
+	}
+
+	// Trades throughput against latency: fewer frames in flight and swap chain images lower the latency, but let the CPU and the GPU
+	// wait on each other more often. The VSync setting of the window maps onto the present mode, FIFO when enabled and Mailbox
+	// otherwise, so changing it replaces the present mode of the current policy.
+	struct PresentationPolicy
+	{
+		static constexpr uint32_t maxFramesInFlight = 3;
+
+		PresentMode presentMode = PresentMode::Mailbox;
+		// Frames the CPU may record while the GPU works on the previous ones, between 1 and maxFramesInFlight
+		uint32_t framesInFlight = 2;
+		// 0 picks one more image than the minimum the surface requires, other counts are clamped to the range it supports
+		uint32_t swapChainImageCount = 0;
+	};
+
 	struct RenderingStatistics
 	{
+		static constexpr std::size_t gpuPassCount = 3;
+
 		uint32_t drawCalls = 0;
 		uint32_t quadCount = 0;
+		uint32_t culledQuadCount = 0;
+		// Milliseconds spent by the GPU on each pass, indexed by GPUPass. The queries are read back without stalling, so these describe
+		// a frame submitted a few frames ago. They stay at 0 with the backends that have no GPU timings.
+		std::array<float, gpuPassCount> gpuPassTimes{};
+		// GPU memory sub-allocated by the backend, which stays at 0 with the backends that don't manage it themselves
+		uint32_t gpuMemoryBlockCount = 0;
+		uint32_t gpuAllocationCount = 0;
+		uint64_t gpuMemoryReserved = 0;
+		uint64_t gpuMemoryUsed = 0;
+		// Milliseconds between the input of the last completed frame being polled and the CPU noticing that the GPU finished the frame,
+		// which only happens at the start of a later frame: it overestimates the GPU completion time by up to a frame. Presentation
+		// (until the vertical blank with FIFO) is not included. It stays at 0 with the backends that don't measure it.
+		float inputToGPUCompletionLatency = 0.f;
 
 		[[nodiscard]] auto getVertexCount() const { return quadCount * 4; }
 		[[nodiscard]] auto getIndexCount() const { return quadCount * 6; }
+		[[nodiscard]] float getGPUPassTime(GPUPass pass) const { return gpuPassTimes[static_cast<std::size_t>(pass)]; }
+		[[nodiscard]] float getGPUFrameTime() const { return gpuPassTimes[0] + gpuPassTimes[1] + gpuPassTimes[2]; }
 	};
 
+	class Renderer2D;
+
 	class Generic2DRenderer
 	{
 	public:
@@ -67,24 +192,33 @@ namespace MRG
 		virtual void beginScene(const EditorCamera& camera) = 0;
 		virtual void endScene() = 0;
 
-		virtual void drawQuad(const glm::mat4& transform, const glm::vec4& color, uint32_t objectID) = 0;
+		virtual void drawQuad(const glm::mat4& transform, const glm::vec4& color, uint32_t objectID);
+		virtual void drawQuad(const glm::mat4& transform, const Ref<Texture2D>& texture, float tilingFactor, const glm::vec4& tintColor);
 		virtual void
-		drawQuad(const glm::mat4& transform, const Ref<Texture2D>& texture, float tilingFactor, const glm::vec4& tintColor) = 0;
+		drawQuad(const glm::mat4& transform, const Ref<SubTexture2D>& subTexture, float tilingFactor, const glm::vec4& tintColor);
+
+		// The spans are expected to have the same size, except for objectIDs which may be empty
+		virtual void drawQuads(Span<const glm::mat4> transforms, Span<const glm::vec4> colors, Span<const uint32_t> objectIDs);
+		virtual void drawQuads(Span<const glm::mat4> transforms,
+		                       const Ref<Texture2D>& texture,
+		                       float tilingFactor,
+		                       Span<const glm::vec4> tintColors,
+		                       Span<const uint32_t> objectIDs);
 
-		virtual void drawQuad(const glm::vec3& position, const glm::vec2& size, const glm::vec4& color) = 0;
+		virtual void drawQuad(const glm::vec3& position, const glm::vec2& size, const glm::vec4& color);
 		virtual void drawQuad(const glm::vec3& position,
 		                      const glm::vec2& size,
 		                      const Ref<Texture2D>& texture,
 		                      float tilingFactor,
-		                      const glm::vec4& tintColor) = 0;
+		                      const glm::vec4& tintColor);
 
-		virtual void drawRotatedQuad(const glm::vec3& position, const glm::vec2& size, float rotation, const glm::vec4& color) = 0;
+		virtual void drawRotatedQuad(const glm::vec3& position, const glm::vec2& size, float rotation, const glm::vec4& color);
 		virtual void drawRotatedQuad(const glm::vec3& position,
 		                             const glm::vec2& size,
 		                             float rotation,
 		                             const Ref<Texture2D>& texture,
 		                             float tilingFactor,
-		                             const glm::vec4& tintColor) = 0;
+		                             const glm::vec4& tintColor);
 
 		virtual void setRenderTarget(Ref<Framebuffer> renderTarget) = 0;
 		virtual void resetRenderTarget() = 0;
@@ -94,8 +228,17 @@ namespace MRG
 		virtual void setClearColor(const glm::vec4& color) = 0;
 		virtual void clear() = 0;
 
-		virtual void resetStats() = 0;
-		[[nodiscard]] virtual RenderingStatistics getStats() const = 0;
+		// Brackets GPU work recorded outside of the renderer (the ImGui pass of the OpenGL backend), for it to show up in the GPU timings.
+		// Backends that record every pass themselves have nothing to do here.
+		virtual void beginGPUPass(GPUPass) {}
+		virtual void endGPUPass() {}
+
+		virtual void resetStats() { m_stats = {}; }
+		[[nodiscard]] virtual RenderingStatistics getStats() const { return m_stats; }
+
+		// Backends that don't manage a swap chain themselves ignore the policy, only following the VSync setting of the window
+		virtual void setPresentationPolicy(const PresentationPolicy&) {}
+		[[nodiscard]] virtual PresentationPolicy getPresentationPolicy() const { return {}; }
 
 		static const uint32_t maxQuads = 10000;
 		static const uint32_t maxVertices = 4 * maxQuads;
@@ -103,6 +246,34 @@ namespace MRG
 		static const uint32_t maxTextureSlots = 32;
 
 	protected:
+		// Ends the current batch, submitting it and freeing the texture slots
+		virtual void flushAndReset() = 0;
+		// Texture slot of the current batch, flushing it first when all the slots are taken
+		[[nodiscard]] virtual float getTextureIndex(const Ref<Texture2D>& texture);
+		// Splits the quads into as many batches as needed, texture may be null for untextured quads
+		virtual void submitQuads(Span<const glm::mat4> transforms,
+		                         const Ref<Texture2D>& texture,
+		                         float tilingFactor,
+		                         Span<const glm::vec4> colors,
+		                         Span<const uint32_t> objectIDs);
+
+		void writeQuad(const glm::mat4& transform, const glm::vec4& color, float texIndex, float tilingFactor, uint32_t objectID);
+		void writeQuad(const glm::mat4& transform,
+		               const glm::vec4& color,
+		               float texIndex,
+		               float tilingFactor,
+		               uint32_t objectID,
+		               const std::array<glm::vec2, 4>& texCoords);
+		// The caller is responsible for making sure the current batch has enough room for count quads
+		void writeQuads(const glm::mat4* transforms,
+		                const glm::vec4* colors,
+		                const uint32_t* objectIDs,
+		                std::size_t count,
+		                float texIndex,
+		                float tilingFactor);
+
+		QuadRenderingMode m_renderingMode = QuadRenderingMode::Batched;
+
 		const std::size_t m_quadVertexCount = 4;
 		const std::array<glm::vec4, 4> m_quadVertexPositions = {glm::vec4{-0.5f, -0.5f, 0.0f, 1.f},
 		                                                        glm::vec4{0.5f, -0.5f, 0.0f, 1.f},
@@ -114,14 +285,21 @@ namespace MRG
 		uint32_t m_quadIndexCount = 0;
 		QuadVertex* m_qvbBase = nullptr;
 		QuadVertex* m_qvbPtr = nullptr;
+		QuadInstance* m_qibBase = nullptr;
+		QuadInstance* m_qibPtr = nullptr;
 		std::array<Ref<Texture2D>, maxTextureSlots> m_textureSlots;
 		std::size_t m_textureSlotindex = 1;
+
+		RenderingStatistics m_stats;
+
+		friend class Renderer2D;
 	};
 
 	class Renderer2D
 	{
 	public:
-		static void init(GLFWwindow* window);
+		// The window may be null when using the Null rendering API
+		static void init(GLFWwindow* window, QuadRenderingMode mode = QuadRenderingMode::Batched);
 		static void shutdown();
 
 		static void onWindowResize(uint32_t width, uint32_t height);
@@ -133,7 +311,15 @@ namespace MRG
 		static void beginScene(const EditorCamera& camera);
 		static void endScene();
 
+		// Stays true after shutdown, the backend being kept until the next init
+		[[nodiscard]] static bool isInitialized() { return s_renderer != nullptr; }
 		[[nodiscard]] static GLFWwindow* getGLFWWindow() { return s_windowHandle; }
+		[[nodiscard]] static QuadRenderingMode getQuadRenderingMode() { return s_renderer->m_renderingMode; }
+
+		static void setQuadSubmissionMode(QuadSubmissionMode mode);
+		[[nodiscard]] static QuadSubmissionMode getQuadSubmissionMode() { return s_submissionMode; }
+		// Quads of a lower layer are always drawn before the ones of a higher layer. Only used in deferred submission mode.
+		static void setSortLayer(uint8_t layer) { s_sortLayer = layer; }
 
 		/// Primitives
 
@@ -157,6 +343,32 @@ namespace MRG
 		                     float tilingFactor = 1.f,
 		                     const glm::vec4& tintColor = glm::vec4{1.f});
 
+		// Bulk versions of drawQuad, paying for the dispatch once for all the quads instead of once per quad.
+		// All spans must have the same size, except for objectIDs which may be left empty.
+		static void
+		drawQuads(Span<const glm::mat4> transforms, Span<const glm::vec4> colors, Span<const uint32_t> objectIDs = Span<const uint32_t>{});
+		static void drawQuads(Span<const glm::mat4> transforms,
+		                      const Ref<Texture2D>& texture,
+		                      float tilingFactor,
+		                      Span<const glm::vec4> tintColors,
+		                      Span<const uint32_t> objectIDs = Span<const uint32_t>{});
+
+		// Note that tiling a sub texture will sample the texture it is part of, not repeat the sub texture itself
+		static void drawQuad(const glm::vec2& position,
+		                     const glm::vec2& size,
+		                     const Ref<SubTexture2D>& subTexture,
+		                     float tilingFactor = 1.f,
+		                     const glm::vec4& tintColor = glm::vec4{1.f});
+		static void drawQuad(const glm::vec3& position,
+		                     const glm::vec2& size,
+		                     const Ref<SubTexture2D>& subTexture,
+		                     float tilingFactor = 1.f,
+		                     const glm::vec4& tintColor = glm::vec4{1.f});
+		static void drawQuad(const glm::mat4& transform,
+		                     const Ref<SubTexture2D>& subTexture,
+		                     float tilingFactor = 1.f,
+		                     const glm::vec4& tintColor = glm::vec4{1.f});
+
 		static void drawRotatedQuad(const glm::vec2& position, const glm::vec2& size, float rotation, const glm::vec4& color);
 		static void drawRotatedQuad(const glm::vec3& position, const glm::vec2& size, float rotation, const glm::vec4& color);
 		static void drawRotatedQuad(const glm::vec2& position,
@@ -180,12 +392,36 @@ namespace MRG
 		static void setClearColor(const glm::vec4& color);
 		static void clear();
 
+		static void beginGPUPass(GPUPass pass);
+		static void endGPUPass();
+
 		static void resetStats();
 		[[nodiscard]] static RenderingStatistics getStats();
+		// Quads skipped before submission (by the scene's frustum culling for instance) are only counted here
+		static void addCulledQuads(uint32_t count) { s_culledQuadCount += count; }
+
+		// Applied at the end of the current frame, without having to restart the renderer
+		static void setPresentationPolicy(const PresentationPolicy& policy);
+		[[nodiscard]] static PresentationPolicy getPresentationPolicy();
 
 	private:
+		// The indices come from the queue's registerTexture and registerSubTexture
+		static void enqueueQuad(const glm::mat4& transform,
+		                        const glm::vec4& color,
+		                        uint32_t textureIndex,
+		                        uint32_t subTextureIndex,
+		                        float tilingFactor,
+		                        uint32_t objectID);
+		static void flushQueue();
+
 		static GLFWwindow* s_windowHandle;
 		static Scope<Generic2DRenderer> s_renderer;
+
+		static QuadSubmissionMode s_submissionMode;
+		static RenderQueue s_renderQueue;
+		static glm::mat4 s_viewProjection;
+		static uint8_t s_sortLayer;
+		static uint32_t s_culledQuadCount;
 	};
 }  // namespace MRG
 
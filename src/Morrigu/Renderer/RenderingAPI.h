@@ -12,9 +12,15 @@ namespace MRG
 		{
 			None = 0,
 			OpenGL,
-			Vulkan
+			Vulkan,
+			// Runs the whole CPU side of the renderer without drawing anything, and without needing a window nor a GPU
+			Null,
+			// Rasterizes on the CPU, for machines without a GPU. Results are read back from the render targets.
+			Software
 		};
 		[[nodiscard]] static auto getAPI() { return s_API; }
+		// Must be called before any window or rendering resource is created
+		static void setAPI(API api) { s_API = api; }
 
 	private:
 		static API s_API;
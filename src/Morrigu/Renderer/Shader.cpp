@@ -1,5 +1,6 @@
 #include "Shader.h"
 
+#include "Renderer/APIs/Null/Shader.h"
 #include "Renderer/APIs/OpenGL/Shader.h"
 #include "Renderer/APIs/Vulkan/Shader.h"
 #include "Renderer/RenderingAPI.h"
@@ -17,6 +18,14 @@ namespace MRG
 			return createRef<Vulkan::Shader>(filePath);
 		}
 
+		case RenderingAPI::API::Null: {
+			return createRef<Null::Shader>(filePath);
+		}
+
+		case RenderingAPI::API::Software: {
+			return createRef<Null::Shader>(filePath);
+		}
+
 		case RenderingAPI::API::None:
 		default: {
 			MRG_CORE_ASSERT(false, fmt::format("UNSUPPORTED RENDERER API OPTION! ({})", RenderingAPI::getAPI()))
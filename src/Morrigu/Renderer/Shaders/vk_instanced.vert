@@ -0,0 +1,35 @@
+#version 450
+
+layout(location = 0) in vec3 a_transformX;
+layout(location = 1) in vec3 a_transformY;
+layout(location = 2) in vec3 a_translation;
+layout(location = 3) in vec4 a_color;
+layout(location = 4) in vec4 a_texRect;
+layout(location = 5) in float a_texIndex;
+layout(location = 6) in float a_tilingFactor;
+layout(location = 7) in uint a_objectID;
+
+layout(push_constant) uniform PushConstants { mat4 viewProjection; }
+u_constants;
+
+layout(location = 0) out vec4 v_color;
+layout(location = 1) out vec2 v_texCoord;
+layout(location = 2) out flat float v_texIndex;
+layout(location = 3) out float v_tilingFactor;
+layout(location = 4) out flat uint v_objectID;
+
+// Same winding as the index buffer used by the batched mode (0, 1, 2, 2, 3, 0)
+const vec2 corners[6] = vec2[](vec2(0.0, 0.0), vec2(1.0, 0.0), vec2(1.0, 1.0), vec2(1.0, 1.0), vec2(0.0, 1.0), vec2(0.0, 0.0));
+
+void main()
+{
+	vec2 corner = corners[gl_VertexIndex];
+	vec3 position = a_transformX * (corner.x - 0.5) + a_transformY * (corner.y - 0.5) + a_translation;
+
+	v_color = a_color;
+	v_texCoord = a_texRect.xy + corner * a_texRect.zw;
+	v_texIndex = a_texIndex;
+	v_tilingFactor = a_tilingFactor;
+	v_objectID = a_objectID;
+	gl_Position = u_constants.viewProjection * vec4(position, 1.0);
+}
@@ -0,0 +1,22 @@
+#include "SubTexture2D.h"
+
+#include <utility>
+
+namespace MRG
+{
+	SubTexture2D::SubTexture2D(Ref<Texture2D> texture, const glm::vec2& min, const glm::vec2& max)
+	    : m_texture{std::move(texture)}, m_texCoords{glm::vec2{min.x, min.y}, glm::vec2{max.x, min.y}, max, glm::vec2{min.x, max.y}}
+	{}
+
+	Ref<SubTexture2D> SubTexture2D::createFromCoords(const Ref<Texture2D>& texture,
+	                                                 const glm::vec2& coords,
+	                                                 const glm::vec2& cellSize,
+	                                                 const glm::vec2& spriteSize)
+	{
+		const glm::vec2 textureSize{texture->getWidth(), texture->getHeight()};
+		const glm::vec2 min = coords * cellSize / textureSize;
+		const glm::vec2 max = (coords + spriteSize) * cellSize / textureSize;
+
+		return createRef<SubTexture2D>(texture, min, max);
+	}
+}  // namespace MRG
@@ -0,0 +1,32 @@
+#ifndef MRG_CLASS_SUBTEXTURE2D
+#define MRG_CLASS_SUBTEXTURE2D
+
+#include "Core/GLMIncludeHelper.h"
+#include "Renderer/Textures.h"
+
+#include <array>
+
+namespace MRG
+{
+	// Rectangular region of a Texture2D, described by its UV bounds. Mostly used to draw images packed in a TextureAtlas.
+	class SubTexture2D
+	{
+	public:
+		SubTexture2D(Ref<Texture2D> texture, const glm::vec2& min, const glm::vec2& max);
+
+		// Selects the cell at coords in a texture evenly divided in cells of cellSize pixels, spanning spriteSize cells.
+		[[nodiscard]] static Ref<SubTexture2D> createFromCoords(const Ref<Texture2D>& texture,
+		                                                        const glm::vec2& coords,
+		                                                        const glm::vec2& cellSize,
+		                                                        const glm::vec2& spriteSize = {1.f, 1.f});
+
+		[[nodiscard]] const Ref<Texture2D>& getTexture() const { return m_texture; }
+		[[nodiscard]] const std::array<glm::vec2, 4>& getTexCoords() const { return m_texCoords; }
+
+	private:
+		Ref<Texture2D> m_texture;
+		std::array<glm::vec2, 4> m_texCoords;
+	};
+}  // namespace MRG
+
+#endif
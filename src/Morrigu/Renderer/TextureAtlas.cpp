@@ -0,0 +1,240 @@
+#include "TextureAtlas.h"
+
+#include "Debug/Instrumentor.h"
+#include "Renderer/ImageLoader.h"
+
+#include <stb_image.h>
+
+#include <algorithm>
+#include <cstring>
+#include <optional>
+
+namespace
+{
+	// Bottom-left skyline packer: the free space of a page is described by the height of its top edge along the x axis.
+	class SkylinePacker
+	{
+	public:
+		explicit SkylinePacker(uint32_t size) : m_size(size) { m_skyline.push_back({0, 0, size}); }
+
+		[[nodiscard]] std::optional<glm::uvec2> insert(uint32_t width, uint32_t height)
+		{
+			std::size_t bestNode = m_skyline.size();
+			uint32_t bestY = UINT32_MAX, bestWidth = UINT32_MAX;
+
+			for (std::size_t i = 0; i < m_skyline.size(); ++i) {
+				const auto y = fit(i, width, height);
+				if (!y.has_value()) {
+					continue;
+				}
+
+				if (*y < bestY || (*y == bestY && m_skyline[i].width < bestWidth)) {
+					bestNode = i;
+					bestY = *y;
+					bestWidth = m_skyline[i].width;
+				}
+			}
+
+			if (bestNode == m_skyline.size()) {
+				return std::nullopt;
+			}
+
+			const glm::uvec2 position{m_skyline[bestNode].x, bestY};
+			addLevel(bestNode, position, width, height);
+			return position;
+		}
+
+	private:
+		struct Node
+		{
+			uint32_t x, y, width;
+		};
+
+		// Returns the height at which a rectangle would rest if its left edge was placed at the start of the given node
+		[[nodiscard]] std::optional<uint32_t> fit(std::size_t index, uint32_t width, uint32_t height) const
+		{
+			const auto x = m_skyline[index].x;
+			if (x + width > m_size) {
+				return std::nullopt;
+			}
+
+			uint32_t y = 0;
+			uint32_t widthLeft = width;
+			for (auto i = index; widthLeft > 0; ++i) {
+				y = std::max(y, m_skyline[i].y);
+				if (y + height > m_size) {
+					return std::nullopt;
+				}
+				widthLeft -= std::min(widthLeft, m_skyline[i].width);
+			}
+
+			return y;
+		}
+
+		void addLevel(std::size_t index, const glm::uvec2& position, uint32_t width, uint32_t height)
+		{
+			m_skyline.insert(m_skyline.begin() + static_cast<std::ptrdiff_t>(index), {position.x, position.y + height, width});
+
+			// Shrink or remove the nodes now covered by the new one
+			for (auto i = index + 1; i < m_skyline.size(); ++i) {
+				const auto& previous = m_skyline[i - 1];
+				const auto previousEnd = previous.x + previous.width;
+				if (m_skyline[i].x >= previousEnd) {
+					break;
+				}
+
+				const auto shrink = previousEnd - m_skyline[i].x;
+				if (m_skyline[i].width > shrink) {
+					m_skyline[i].x += shrink;
+					m_skyline[i].width -= shrink;
+					break;
+				}
+
+				m_skyline.erase(m_skyline.begin() + static_cast<std::ptrdiff_t>(i));
+				--i;
+			}
+
+			// Merge neighbours of the same height
+			for (std::size_t i = 0; i + 1 < m_skyline.size();) {
+				if (m_skyline[i].y == m_skyline[i + 1].y) {
+					m_skyline[i].width += m_skyline[i + 1].width;
+					m_skyline.erase(m_skyline.begin() + static_cast<std::ptrdiff_t>(i + 1));
+				} else {
+					++i;
+				}
+			}
+		}
+
+		uint32_t m_size;
+		std::vector<Node> m_skyline;
+	};
+
+	struct Placement
+	{
+		std::size_t imageIndex;
+		std::size_t page;
+		glm::uvec2 position;
+	};
+}  // namespace
+
+namespace MRG
+{
+	TextureAtlas::TextureAtlas(const TextureAtlasSpecification& specification) : m_specification(specification) {}
+
+	TextureAtlas::~TextureAtlas()
+	{
+		for (const auto& image : m_pendingImages) { stbi_image_free(image.pixels); }
+	}
+
+	void TextureAtlas::add(const std::string& name, const std::string& path)
+	{
+		MRG_PROFILE_FUNCTION()
+
+		int width, height, channels;
+		const auto pixels = ImageLoader::loadFromFile(path.c_str(), &width, &height, &channels, STBI_rgb_alpha, true);
+		MRG_CORE_ASSERT(pixels, fmt::format("Failed to load file '{}'", path))
+		MRG_CORE_ASSERT(static_cast<uint32_t>(std::max(width, height)) + 2 * m_specification.padding <= m_specification.pageSize,
+		                fmt::format("Image '{}' is too large to fit in an atlas page!", path))
+
+		m_pendingImages.push_back({name, pixels, static_cast<uint32_t>(width), static_cast<uint32_t>(height)});
+	}
+
+	void TextureAtlas::build()
+	{
+		MRG_PROFILE_FUNCTION()
+
+		if (m_pendingImages.empty()) {
+			return;
+		}
+
+		const auto pageSize = m_specification.pageSize;
+		const auto padding = m_specification.padding;
+
+		// Packing the tallest images first gives a much flatter skyline
+		std::vector<std::size_t> order(m_pendingImages.size());
+		for (std::size_t i = 0; i < order.size(); ++i) { order[i] = i; }
+		std::sort(order.begin(), order.end(), [this](std::size_t a, std::size_t b) {
+			return m_pendingImages[a].height > m_pendingImages[b].height;
+		});
+
+		std::vector<SkylinePacker> packers;
+		std::vector<Placement> placements;
+		placements.reserve(order.size());
+		for (const auto imageIndex : order) {
+			const auto& image = m_pendingImages[imageIndex];
+			const auto paddedWidth = image.width + 2 * padding;
+			const auto paddedHeight = image.height + 2 * padding;
+
+			std::optional<glm::uvec2> position;
+			std::size_t page = 0;
+			for (; page < packers.size() && !position.has_value(); ++page) { position = packers[page].insert(paddedWidth, paddedHeight); }
+			if (position.has_value()) {
+				--page;
+			} else {
+				packers.emplace_back(pageSize);
+				page = packers.size() - 1;
+				position = packers.back().insert(paddedWidth, paddedHeight);
+			}
+
+			placements.push_back({imageIndex, page, *position});
+		}
+
+		std::vector<std::vector<uint32_t>> pagesPixels(packers.size(), std::vector<uint32_t>(pageSize * pageSize, 0));
+		for (const auto& placement : placements) {
+			const auto& image = m_pendingImages[placement.imageIndex];
+			const auto source = reinterpret_cast<const uint32_t*>(image.pixels);
+			auto& destination = pagesPixels[placement.page];
+			const auto originX = placement.position.x + padding;
+			const auto originY = placement.position.y + padding;
+
+			for (uint32_t y = 0; y < image.height; ++y) {
+				std::memcpy(&destination[(originY + y) * pageSize + originX], &source[y * image.width], image.width * sizeof(uint32_t));
+			}
+
+			if (m_specification.extrudeBorders && padding > 0) {
+				const auto lastX = image.width - 1, lastY = image.height - 1;
+				for (uint32_t y = 0; y < image.height + 2 * padding; ++y) {
+					const auto sourceY = std::clamp(static_cast<int64_t>(y) - padding, int64_t{0}, static_cast<int64_t>(lastY));
+					for (uint32_t x = 0; x < image.width + 2 * padding; ++x) {
+						const auto isBorder = x < padding || y < padding || x >= image.width + padding || y >= image.height + padding;
+						if (!isBorder) {
+							continue;
+						}
+
+						const auto sourceX = std::clamp(static_cast<int64_t>(x) - padding, int64_t{0}, static_cast<int64_t>(lastX));
+						destination[(placement.position.y + y) * pageSize + placement.position.x + x] =
+						  source[sourceY * image.width + sourceX];
+					}
+				}
+			}
+		}
+
+		const auto firstPage = m_pages.size();
+		for (auto& pixels : pagesPixels) {
+			auto page = Texture2D::create(pageSize, pageSize);
+			page->setData(pixels.data(), static_cast<uint32_t>(pixels.size() * sizeof(uint32_t)));
+			m_pages.push_back(page);
+		}
+
+		for (const auto& placement : placements) {
+			const auto& image = m_pendingImages[placement.imageIndex];
+			const auto min = glm::vec2{placement.position + padding} / static_cast<float>(pageSize);
+			const auto max = min + glm::vec2{image.width, image.height} / static_cast<float>(pageSize);
+
+			m_subTextures[image.name] = createRef<SubTexture2D>(m_pages[firstPage + placement.page], min, max);
+		}
+
+		for (const auto& image : m_pendingImages) { stbi_image_free(image.pixels); }
+		m_pendingImages.clear();
+
+		MRG_ENGINE_INFO("Packed {} images into {} atlas pages", placements.size(), pagesPixels.size())
+	}
+
+	Ref<SubTexture2D> TextureAtlas::get(const std::string& name) const
+	{
+		const auto subTexture = m_subTextures.find(name);
+		MRG_CORE_ASSERT(subTexture != m_subTextures.end(), fmt::format("No image named '{}' has been packed in this atlas!", name))
+
+		return subTexture->second;
+	}
+}  // namespace MRG
@@ -0,0 +1,57 @@
+#ifndef MRG_CLASS_TEXTUREATLAS
+#define MRG_CLASS_TEXTUREATLAS
+
+#include "Renderer/SubTexture2D.h"
+
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace MRG
+{
+	struct TextureAtlasSpecification
+	{
+		// Pages are square textures of pageSize pixels
+		uint32_t pageSize = 2048;
+		// Empty pixels left around each image to avoid bleeding when sampling near its edges
+		uint32_t padding = 2;
+		// Fill the padding with copies of the image edges instead of transparent pixels
+		bool extrudeBorders = true;
+	};
+
+	// Packs many images into a few large Texture2D pages, so that drawing them does not require switching textures.
+	// Images are queued with add(), and only uploaded to the GPU once build() is called.
+	class TextureAtlas
+	{
+	public:
+		explicit TextureAtlas(const TextureAtlasSpecification& specification = TextureAtlasSpecification{});
+		TextureAtlas(const TextureAtlas&) = delete;
+		TextureAtlas(TextureAtlas&&) = delete;
+		~TextureAtlas();
+
+		TextureAtlas& operator=(const TextureAtlas&) = delete;
+		TextureAtlas& operator=(TextureAtlas&&) = delete;
+
+		void add(const std::string& name, const std::string& path);
+		void build();
+
+		[[nodiscard]] Ref<SubTexture2D> get(const std::string& name) const;
+		[[nodiscard]] const std::vector<Ref<Texture2D>>& getPages() const { return m_pages; }
+		[[nodiscard]] const TextureAtlasSpecification& getSpecification() const { return m_specification; }
+
+	private:
+		struct PendingImage
+		{
+			std::string name;
+			unsigned char* pixels;
+			uint32_t width, height;
+		};
+
+		TextureAtlasSpecification m_specification;
+		std::vector<PendingImage> m_pendingImages;
+		std::vector<Ref<Texture2D>> m_pages;
+		std::unordered_map<std::string, Ref<SubTexture2D>> m_subTextures;
+	};
+}  // namespace MRG
+
+#endif
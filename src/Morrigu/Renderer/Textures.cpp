@@ -1,6 +1,8 @@
 #include "Textures.h"
 
+#include "Renderer/APIs/Null/Textures.h"
 #include "Renderer/APIs/OpenGL/Textures.h"
+#include "Renderer/APIs/Software/Textures.h"
 #include "Renderer/APIs/Vulkan/Textures.h"
 #include "Renderer/RenderingAPI.h"
 
@@ -17,6 +19,14 @@ namespace MRG
 			return createRef<Vulkan::Texture2D>(width, height);
 		}
 
+		case RenderingAPI::API::Null: {
+			return createRef<Null::Texture2D>(width, height);
+		}
+
+		case RenderingAPI::API::Software: {
+			return createRef<Software::Texture2D>(width, height);
+		}
+
 		case RenderingAPI::API::None:
 		default: {
 			MRG_CORE_ASSERT(false, fmt::format("UNSUPPORTED RENDERER API OPTION! ({})", RenderingAPI::getAPI()))
@@ -36,6 +46,14 @@ namespace MRG
 			return createRef<Vulkan::Texture2D>(path);
 		}
 
+		case RenderingAPI::API::Null: {
+			return createRef<Null::Texture2D>(path);
+		}
+
+		case RenderingAPI::API::Software: {
+			return createRef<Software::Texture2D>(path);
+		}
+
 		case RenderingAPI::API::None:
 		default: {
 			MRG_CORE_ASSERT(false, fmt::format("UNSUPPORTED RENDERER API OPTION! ({})", RenderingAPI::getAPI()))
@@ -26,6 +26,8 @@ namespace MRG
 		[[nodiscard]] virtual uint32_t getWidth() const = 0;
 		[[nodiscard]] virtual uint32_t getHeight() const = 0;
 		[[nodiscard]] virtual ImTextureID getImTextureID() = 0;
+		// Uploads can complete asynchronously, and textures drawn before being ready are replaced by a white texture
+		[[nodiscard]] virtual bool isReady() const { return true; }
 
 		virtual void setData(void* data, uint32_t size) = 0;
 
@@ -1,5 +1,6 @@
 #include "VertexArray.h"
 
+#include "Renderer/APIs/Null/VertexArray.h"
 #include "Renderer/APIs/OpenGL/VertexArray.h"
 #include "Renderer/APIs/Vulkan/VertexArray.h"
 #include "Renderer/RenderingAPI.h"
@@ -17,6 +18,14 @@ namespace MRG
 			return createRef<Vulkan::VertexArray>();
 		}
 
+		case RenderingAPI::API::Null: {
+			return createRef<Null::VertexArray>();
+		}
+
+		case RenderingAPI::API::Software: {
+			return createRef<Null::VertexArray>();
+		}
+
 		case RenderingAPI::API::None:
 		default: {
 			MRG_CORE_ASSERT(false, fmt::format("UNSUPPORTED RENDERER API OPTION! ({})", RenderingAPI::getAPI()))
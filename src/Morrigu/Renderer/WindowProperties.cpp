@@ -16,6 +16,11 @@ namespace MRG
 			return createScope<Vulkan::WindowProperties>(title, width, height, vSync);
 		}
 
+		case RenderingAPI::API::Null:
+		case RenderingAPI::API::Software: {
+			return createScope<WindowProperties>(WindowProperties{title, width, height, vSync});
+		}
+
 		case RenderingAPI::API::None:
 		default: {
 			MRG_CORE_ASSERT(false, fmt::format("UNSUPPORTED RENDERER API OPTION! ({})", RenderingAPI::getAPI()))
@@ -19,17 +19,42 @@ namespace MRG
 
 	struct TransformComponent
 	{
-		glm::vec3 translation{0.f, 0.f, 0.f};
-		glm::vec3 rotation{0.f, 0.f, 0.f};
-		glm::vec3 scale{1.f, 1.f, 1.f};
-
 		TransformComponent() = default;
-		explicit TransformComponent(const glm::vec3& newTranslation) : translation(newTranslation) {}
+		explicit TransformComponent(const glm::vec3& newTranslation) : m_translation(newTranslation) {}
+
+		[[nodiscard]] const glm::vec3& getTranslation() const { return m_translation; }
+		[[nodiscard]] const glm::vec3& getRotation() const { return m_rotation; }
+		[[nodiscard]] const glm::vec3& getScale() const { return m_scale; }
+		// Incremented by every setter, so that the data derived from the transform is only recomputed when it changes
+		[[nodiscard]] uint32_t getVersion() const { return m_version; }
+
+		void setTranslation(const glm::vec3& translation)
+		{
+			m_translation = translation;
+			++m_version;
+		}
+		void setRotation(const glm::vec3& rotation)
+		{
+			m_rotation = rotation;
+			++m_version;
+		}
+		void setScale(const glm::vec3& scale)
+		{
+			m_scale = scale;
+			++m_version;
+		}
 
 		[[nodiscard]] glm::mat4 getTransform() const
 		{
-			return glm::translate(glm::mat4{1.f}, translation) * glm::toMat4(glm::quat(rotation)) * glm::scale(glm::mat4{1.f}, scale);
+			return glm::translate(glm::mat4{1.f}, m_translation) * glm::toMat4(glm::quat(m_rotation)) *
+			       glm::scale(glm::mat4{1.f}, m_scale);
 		}
+
+	private:
+		glm::vec3 m_translation{0.f, 0.f, 0.f};
+		glm::vec3 m_rotation{0.f, 0.f, 0.f};
+		glm::vec3 m_scale{1.f, 1.f, 1.f};
+		uint32_t m_version = 0;
 	};
 
 	struct SpriteRendererComponent
@@ -40,6 +65,39 @@ namespace MRG
 		explicit SpriteRendererComponent(const glm::vec4& newColor) : color(newColor) {}
 	};
 
+	// Internal component, caching the world space transform of a sprite. It only wraps the matrix, so that the packed array of
+	// these components can be handed to the renderer as is.
+	struct SpriteTransformComponent
+	{
+		glm::mat4 transform{1.f};
+	};
+
+	// Internal component, caching the world space bounds of a sprite. They are only recomputed when the transform changes.
+	struct SpriteBoundsComponent
+	{
+		glm::vec3 center{0.f};
+		glm::vec3 extents{0.f};
+
+		void update(const TransformComponent& tc, SpriteTransformComponent& stc)
+		{
+			if (m_isValid && tc.getVersion() == m_transformVersion) {
+				return;
+			}
+
+			m_transformVersion = tc.getVersion();
+			m_isValid = true;
+
+			// World space AABB of the unit quad
+			stc.transform = tc.getTransform();
+			center = glm::vec3{stc.transform[3]};
+			extents = 0.5f * (glm::abs(glm::vec3{stc.transform[0]}) + glm::abs(glm::vec3{stc.transform[1]}));
+		}
+
+	private:
+		uint32_t m_transformVersion = 0;
+		bool m_isValid = false;
+	};
+
 	struct CameraComponent
 	{
 		SceneCamera camera;
@@ -242,13 +242,17 @@ namespace MRG
 		ImGui::PopItemWidth();
 
 		drawComponent<TransformComponent>("Transform", entity, [](TransformComponent& component) {
-			drawVec3Control("Translation", component.translation);
+			auto translation = component.getTranslation();
+			drawVec3Control("Translation", translation);
+			component.setTranslation(translation);
 
-			glm::vec3 rotation = glm::degrees(component.rotation);
+			glm::vec3 rotation = glm::degrees(component.getRotation());
 			drawVec3Control("Rotation", rotation);
-			component.rotation = glm::radians(rotation);
+			component.setRotation(glm::radians(rotation));
 
-			drawVec3Control("Scale", component.scale, 1.f);
+			auto scale = component.getScale();
+			drawVec3Control("Scale", scale, 1.f);
+			component.setScale(scale);
 		});
 
 		drawComponent<CameraComponent>("Camera", entity, [](CameraComponent& component) {
@@ -1,10 +1,27 @@
 #include "Scene.h"
 
+#include "Debug/Instrumentor.h"
 #include "Renderer/Renderer2D.h"
 #include "Scene/Components.h"
 
+#include <type_traits>
+
+namespace
+{
+	// The sprite components and the entities only wrap the element type the renderer expects, so their packed arrays can be read as such
+	template<typename Element, typename Component>
+	[[nodiscard]] MRG::Span<const Element> asElements(const Component* components, std::size_t count)
+	{
+		static_assert(sizeof(Component) == sizeof(Element) && std::is_standard_layout_v<Component>,
+		              "the component has to be laid out as the element!");
+		return {reinterpret_cast<const Element*>(components), count};
+	}
+}  // namespace
+
 namespace MRG
 {
+	Scene::Scene() { m_registry.on_destroy<SpriteRendererComponent>().connect<&Scene::onSpriteRendererDestroyed>(*this); }
+
 	Entity Scene::createEntity(const std::string& name)
 	{
 		Entity entity = {m_registry.create(), this};
@@ -35,14 +52,11 @@ namespace MRG
 			if (!mainCamera.value().hasComponent<TransformComponent>()) {
 				MRG_ENGINE_ERROR("Primary camera doesn't have a tranform component!")
 			}
-			Renderer2D::beginScene(mainCamera.value().getComponent<CameraComponent>().camera,
-			                       mainCamera.value().getComponent<TransformComponent>().getTransform());
+			const auto& camera = mainCamera.value().getComponent<CameraComponent>().camera;
+			const auto cameraTransform = mainCamera.value().getComponent<TransformComponent>().getTransform();
+			Renderer2D::beginScene(camera, cameraTransform);
 
-			const auto& group = m_registry.group<TransformComponent>(entt::get<SpriteRendererComponent>);
-			for (const auto& entity : group) {
-				const auto [tc, sc] = group.get<TransformComponent, SpriteRendererComponent>(entity);
-				Renderer2D::drawQuad(tc.getTransform(), sc.color, static_cast<uint32_t>(entity));
-			}
+			drawSprites(camera.getProjection() * glm::inverse(cameraTransform));
 
 			Renderer2D::endScene();
 		}
@@ -52,11 +66,7 @@ namespace MRG
 	{
 		Renderer2D::beginScene(camera);
 
-		const auto group = m_registry.group<TransformComponent>(entt::get<SpriteRendererComponent>);
-		for (const auto& entity : group) {
-			auto [tc, src] = group.get<TransformComponent, SpriteRendererComponent>(entity);
-			Renderer2D::drawQuad(tc.getTransform(), src.color, static_cast<uint32_t>(entity));
-		}
+		drawSprites(camera.getViewProjection());
 
 		Renderer2D::endScene();
 	}
@@ -88,6 +98,52 @@ namespace MRG
 		return std::nullopt;
 	}
 
+	void Scene::drawSprites(const glm::mat4& viewProjection)
+	{
+		MRG_PROFILE_FUNCTION()
+
+		// Owning every sprite component keeps them packed in the same order, so that they can be read as plain arrays
+		const auto group =
+		  m_registry.group<TransformComponent, SpriteRendererComponent, SpriteTransformComponent, SpriteBoundsComponent>();
+		const auto spriteCount = group.size();
+		const auto entities = group.data();
+		const auto transforms = group.raw<TransformComponent>();
+		const auto spriteTransforms = group.raw<SpriteTransformComponent>();
+		const auto bounds = group.raw<SpriteBoundsComponent>();
+
+		m_spriteBounds.clear();
+		for (std::size_t i = 0; i < spriteCount; ++i) {
+			bounds[i].update(transforms[i], spriteTransforms[i]);
+			m_spriteBounds.push(bounds[i].center, bounds[i].extents);
+		}
+
+		Maths::cullBoxes(Maths::Frustum{viewProjection}, m_spriteBounds, m_spriteVisibility);
+
+		const auto worldTransforms = asElements<glm::mat4>(spriteTransforms, spriteCount);
+		const auto colors = asElements<glm::vec4>(group.raw<SpriteRendererComponent>(), spriteCount);
+		const auto objectIDs = asElements<uint32_t>(entities, spriteCount);
+
+		// Culling leaves holes in the packed arrays, so each run of visible sprites is submitted straight from them
+		std::size_t visibleCount = 0;
+		std::size_t runStart = 0;
+		while (runStart < spriteCount) {
+			if (m_spriteVisibility[runStart] == 0) {
+				++runStart;
+				continue;
+			}
+
+			auto runEnd = runStart + 1;
+			while (runEnd < spriteCount && m_spriteVisibility[runEnd] != 0) { ++runEnd; }
+
+			const auto runSize = runEnd - runStart;
+			Renderer2D::drawQuads(
+			  worldTransforms.subspan(runStart, runSize), colors.subspan(runStart, runSize), objectIDs.subspan(runStart, runSize));
+			visibleCount += runSize;
+			runStart = runEnd;
+		}
+		Renderer2D::addCulledQuads(static_cast<uint32_t>(spriteCount - visibleCount));
+	}
+
 	template<>
 	void Scene::onComponentAdded<TransformComponent>(Entity, TransformComponent&)
 	{}
@@ -99,8 +155,17 @@ namespace MRG
 	}
 
 	template<>
-	void Scene::onComponentAdded<SpriteRendererComponent>(Entity, SpriteRendererComponent&)
-	{}
+	void Scene::onComponentAdded<SpriteRendererComponent>(Entity entity, SpriteRendererComponent&)
+	{
+		m_registry.emplace_or_replace<SpriteTransformComponent>(static_cast<entt::entity>(entity));
+		m_registry.emplace_or_replace<SpriteBoundsComponent>(static_cast<entt::entity>(entity));
+	}
+
+	void Scene::onSpriteRendererDestroyed(entt::registry& registry, entt::entity entity)
+	{
+		// The sprite's internal components are destroyed along with it, whether the entity is destroyed or only the sprite removed
+		registry.remove_if_exists<SpriteTransformComponent, SpriteBoundsComponent>(entity);
+	}
 
 	template<>
 	void Scene::onComponentAdded<TagComponent>(Entity, TagComponent&)
@@ -2,6 +2,7 @@
 #define MRG_CLASS_SCENE
 
 #include "Core/Timestep.h"
+#include "Maths/Frustum.h"
 #include "Renderer/EditorCamera.h"
 
 #include <entt/entity/registry.hpp>
@@ -15,6 +16,15 @@ namespace MRG
 	class Scene
 	{
 	public:
+		Scene();
+		// The registry signals refer to the scene
+		Scene(const Scene&) = delete;
+		Scene(Scene&&) = delete;
+		~Scene() = default;
+
+		Scene& operator=(const Scene&) = delete;
+		Scene& operator=(Scene&&) = delete;
+
 		Entity createEntity(const std::string& name = std::string{});
 		void destroyEntity(Entity entity);
 
@@ -27,10 +37,17 @@ namespace MRG
 	private:
 		template<typename T>
 		void onComponentAdded(Entity entity, T& component);
+		void onSpriteRendererDestroyed(entt::registry& registry, entt::entity entity);
+
+		void drawSprites(const glm::mat4& viewProjection);
 
 		entt::registry m_registry;
 		uint32_t m_viewportWidth = 0, m_viewportHeight = 0;
 
+		// Kept between frames to avoid reallocating them
+		Maths::BoxArray m_spriteBounds;
+		std::vector<uint8_t> m_spriteVisibility;
+
 		friend class Entity;
 		friend class SceneSerializer;
 		friend class SceneHierarchyPanel;
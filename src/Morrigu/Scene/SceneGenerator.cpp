@@ -0,0 +1,156 @@
+#include "SceneGenerator.h"
+
+#include "Core/Random.h"
+#include "Debug/Instrumentor.h"
+#include "Scene/Components.h"
+#include "Scene/SceneSerializer.h"
+
+#include <fmt/format.h>
+
+#include <algorithm>
+#include <cmath>
+
+namespace
+{
+	// Transforms are restricted to a rotation around z and a uniform scale, and children offsets are not rotated by their parent.
+	// This keeps the generation free of any libm call (only basic operations and sqrt are guaranteed to be correctly rounded),
+	// so that the scenes are bit identical on every platform.
+	struct NodeTransform
+	{
+		glm::vec3 translation{0.f};
+		float rotation = 0.f;
+		float scale = 1.f;
+	};
+
+	// Approximately normal in [-1, 1], built from uniform values only for the same reason
+	[[nodiscard]] float nextBellFloat(MRG::Random& random)
+	{
+		auto value = random.nextFloat(-1.f, 1.f);
+		value += random.nextFloat(-1.f, 1.f);
+		value += random.nextFloat(-1.f, 1.f);
+		return value / 3.f;
+	}
+}  // namespace
+
+namespace MRG
+{
+	SceneGenerator::SceneGenerator(const SceneGenerationSpec& spec)
+	    : m_spec(spec), m_extent(spec.extent > 0.f ? spec.extent : std::sqrt(static_cast<float>(std::max(spec.entityCount, 1u))))
+	{}
+
+	Ref<Scene> SceneGenerator::generate() const
+	{
+		MRG_PROFILE_FUNCTION()
+
+		auto scene = createRef<Scene>();
+
+		const auto cameraSize = (m_spec.cameraSize > 0.f) ? m_spec.cameraSize : 2.f * m_extent;
+		for (uint32_t i = 0; i < m_spec.cameraCount; ++i) {
+			auto& camera = scene->createEntity((i == 0) ? "Camera" : fmt::format("Camera {}", i)).addComponent<CameraComponent>();
+			camera.primary = (i == 0);
+			camera.camera.setOrthographic(cameraSize, -1.f, 1.f);
+		}
+
+		populate(*scene);
+		return scene;
+	}
+
+	std::vector<Entity> SceneGenerator::populate(Scene& scene) const
+	{
+		MRG_PROFILE_FUNCTION()
+
+		Random random{m_spec.seed};
+
+		// Trees are stored in heap order, the parent of the node k being the node (k - 1) / childrenPerEntity
+		const auto depth = std::max(m_spec.hierarchyDepth, 1u);
+		const auto childrenPerEntity = std::max(m_spec.childrenPerEntity, 1u);
+		uint64_t fullTreeSize = 0;
+		for (uint64_t level = 0, levelSize = 1; level < depth && fullTreeSize < m_spec.entityCount; ++level) {
+			fullTreeSize += levelSize;
+			levelSize *= childrenPerEntity;
+		}
+		const auto treeSize = static_cast<uint32_t>(std::clamp<uint64_t>(fullTreeSize, 1, std::max(m_spec.entityCount, 1u)));
+		const auto rootCount = (m_spec.entityCount + treeSize - 1) / treeSize;
+
+		std::vector<glm::vec2> clusterCenters;
+		const auto clusterCount = std::max(m_spec.clusterCount, 1u);
+		const auto clusterRadius = m_extent / std::sqrt(static_cast<float>(clusterCount));
+		if (m_spec.distribution == SpatialDistribution::Clustered) {
+			clusterCenters.reserve(clusterCount);
+			for (uint32_t i = 0; i < clusterCount; ++i) {
+				clusterCenters.emplace_back(glm::vec2{random.nextFloat(-m_extent, m_extent), random.nextFloat(-m_extent, m_extent)});
+			}
+		}
+
+		const auto gridSide = static_cast<uint32_t>(std::ceil(std::sqrt(static_cast<float>(rootCount))));
+		const auto gridSpacing = 2.f * m_extent / static_cast<float>(std::max(gridSide, 1u));
+
+		const auto getRootPosition = [&](uint32_t root) {
+			switch (m_spec.distribution) {
+			case SpatialDistribution::Grid: {
+				const auto column = static_cast<float>(root % gridSide);
+				const auto row = static_cast<float>(root / gridSide);
+				return glm::vec2{-m_extent + gridSpacing * (column + 0.5f), -m_extent + gridSpacing * (row + 0.5f)};
+			}
+
+			case SpatialDistribution::Clustered: {
+				const auto& center = clusterCenters[random.nextUint(clusterCount)];
+				const auto x = nextBellFloat(random);
+				const auto y = nextBellFloat(random);
+				return center + clusterRadius * glm::vec2{x, y};
+			}
+
+			case SpatialDistribution::Uniform:
+			default:
+				return glm::vec2{random.nextFloat(-m_extent, m_extent), random.nextFloat(-m_extent, m_extent)};
+			}
+		};
+
+		std::vector<Entity> entities;
+		entities.reserve(m_spec.entityCount);
+		std::vector<NodeTransform> tree(treeSize);
+
+		for (uint32_t i = 0; i < m_spec.entityCount; ++i) {
+			const auto node = i % treeSize;
+
+			auto& transform = tree[node];
+			if (node == 0) {
+				const auto position = getRootPosition(i / treeSize);
+				transform.translation = glm::vec3{position, random.nextFloat(-0.5f, 0.5f)};
+				transform.rotation = glm::radians(random.nextFloat(0.f, 360.f));
+				transform.scale = random.nextFloat(0.5f, 1.5f);
+			} else {
+				const auto& parent = tree[(node - 1) / childrenPerEntity];
+				const glm::vec3 offset{random.nextFloat(-2.f, 2.f), random.nextFloat(-2.f, 2.f), 0.f};
+				transform.translation = parent.translation + parent.scale * offset;
+				transform.rotation = parent.rotation + glm::radians(random.nextFloat(-45.f, 45.f));
+				transform.scale = parent.scale * 0.5f;
+			}
+
+			// Everything is drawn even when not used, so that changing the sprite ratio does not move the entities around
+			const auto hasSprite = random.nextFloat() < m_spec.spriteRatio;
+			const glm::vec4 color{random.nextFloat(), random.nextFloat(), random.nextFloat(), random.nextFloat(0.5f, 1.f)};
+
+			auto entity = scene.createEntity(fmt::format("Entity {}", i));
+			auto& tc = entity.getComponent<TransformComponent>();
+			tc.setTranslation(transform.translation);
+			tc.setRotation({0.f, 0.f, transform.rotation});
+			tc.setScale({transform.scale, transform.scale, 1.f});
+			if (hasSprite) {
+				entity.addComponent<SpriteRendererComponent>().color = color;
+			}
+
+			entities.emplace_back(entity);
+		}
+
+		return entities;
+	}
+
+	void SceneGenerator::generateToFile(const std::string& filepath) const
+	{
+		MRG_PROFILE_FUNCTION()
+
+		SceneSerializer serializer{generate()};
+		serializer.serialize(filepath);
+	}
+}  // namespace MRG
@@ -0,0 +1,61 @@
+#ifndef MRG_CLASS_SCENEGENERATOR
+#define MRG_CLASS_SCENEGENERATOR
+
+#include "Core/Core.h"
+#include "Scene/Entity.h"
+#include "Scene/Scene.h"
+
+#include <string>
+#include <vector>
+
+namespace MRG
+{
+	enum class SpatialDistribution
+	{
+		Uniform,
+		Grid,
+		Clustered,
+	};
+
+	struct SceneGenerationSpec
+	{
+		uint32_t seed = 1;
+		uint32_t entityCount = 1000;
+		// Fraction of the entities with a sprite, the others only have a transform and a tag
+		float spriteRatio = 1.f;
+		// The first camera is the primary one
+		uint32_t cameraCount = 1;
+		// Orthographic size of the cameras, 0 fits the whole scene vertically
+		float cameraSize = 0.f;
+
+		SpatialDistribution distribution = SpatialDistribution::Uniform;
+		// Half size of the square the root entities are placed in, 0 scales it with the entity count to keep the density constant
+		float extent = 0.f;
+		uint32_t clusterCount = 16;
+
+		// Entities are grouped in trees of this depth, 1 meaning that all of them are roots. The scene has no parenting, so the
+		// transforms of the children are baked in world space from the ones of their parents.
+		uint32_t hierarchyDepth = 1;
+		uint32_t childrenPerEntity = 4;
+	};
+
+	// Generates the same scene for a given spec on every platform, so that stress scenes can be compared between machines
+	class SceneGenerator
+	{
+	public:
+		explicit SceneGenerator(const SceneGenerationSpec& spec);
+
+		[[nodiscard]] Ref<Scene> generate() const;
+		// Adds the generated entities (cameras excluded) to an existing scene, and returns them
+		std::vector<Entity> populate(Scene& scene) const;
+		void generateToFile(const std::string& filepath) const;
+
+		[[nodiscard]] float getExtent() const { return m_extent; }
+
+	private:
+		SceneGenerationSpec m_spec;
+		float m_extent;
+	};
+}  // namespace MRG
+
+#endif
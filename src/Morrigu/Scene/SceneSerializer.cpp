@@ -144,9 +144,9 @@ namespace
 				out << YAML::Key << SceneKeys::Entities::Transform::key << YAML::BeginMap;
 				{
 					auto& tc = entity.getComponent<MRG::TransformComponent>();
-					out << YAML::Key << SceneKeys::Entities::Transform::translation << YAML::Value << tc.translation;
-					out << YAML::Key << SceneKeys::Entities::Transform::rotation << YAML::Value << tc.rotation;
-					out << YAML::Key << SceneKeys::Entities::Transform::scale << YAML::Value << tc.scale;
+					out << YAML::Key << SceneKeys::Entities::Transform::translation << YAML::Value << tc.getTranslation();
+					out << YAML::Key << SceneKeys::Entities::Transform::rotation << YAML::Value << tc.getRotation();
+					out << YAML::Key << SceneKeys::Entities::Transform::scale << YAML::Value << tc.getScale();
 				}
 				out << YAML::EndMap;
 			}
@@ -249,9 +249,9 @@ namespace MRG
 			if (transform != nullptr) {
 				auto& tc = newEntity.getComponent<TransformComponent>();
 
-				tc.translation = transform[SceneKeys::Entities::Transform::translation].as<glm::vec3>();
-				tc.rotation = transform[SceneKeys::Entities::Transform::rotation].as<glm::vec3>();
-				tc.scale = transform[SceneKeys::Entities::Transform::scale].as<glm::vec3>();
+				tc.setTranslation(transform[SceneKeys::Entities::Transform::translation].as<glm::vec3>());
+				tc.setRotation(transform[SceneKeys::Entities::Transform::rotation].as<glm::vec3>());
+				tc.setScale(transform[SceneKeys::Entities::Transform::scale].as<glm::vec3>());
 			}
 
 			const auto camera = entity[SceneKeys::Entities::Camera::key];
@@ -0,0 +1,38 @@
+#include "AllocationCounter.h"
+
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+namespace
+{
+	std::atomic<uint64_t> allocationCount{0};
+	std::atomic<uint64_t> allocatedBytes{0};
+
+	[[nodiscard]] void* countedAllocation(std::size_t size)
+	{
+		allocationCount.fetch_add(1, std::memory_order_relaxed);
+		allocatedBytes.fetch_add(size, std::memory_order_relaxed);
+
+		if (auto pointer = std::malloc(size != 0 ? size : 1)) {
+			return pointer;
+		}
+		throw std::bad_alloc{};
+	}
+}  // namespace
+
+namespace MRG::Bench
+{
+	AllocationCounts getAllocationCounts()
+	{
+		return {allocationCount.load(std::memory_order_relaxed), allocatedBytes.load(std::memory_order_relaxed)};
+	}
+}  // namespace MRG::Bench
+
+// The nothrow forms of operator new end up calling these ones. The over-aligned forms are left alone, and are not counted.
+void* operator new(std::size_t size) { return countedAllocation(size); }
+void* operator new[](std::size_t size) { return countedAllocation(size); }
+void operator delete(void* pointer) noexcept { std::free(pointer); }
+void operator delete[](void* pointer) noexcept { std::free(pointer); }
+void operator delete(void* pointer, std::size_t) noexcept { std::free(pointer); }
+void operator delete[](void* pointer, std::size_t) noexcept { std::free(pointer); }
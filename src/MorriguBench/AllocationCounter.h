@@ -0,0 +1,18 @@
+#ifndef MRG_BENCH_ALLOCATIONCOUNTER
+#define MRG_BENCH_ALLOCATIONCOUNTER
+
+#include <cstdint>
+
+namespace MRG::Bench
+{
+	struct AllocationCounts
+	{
+		uint64_t allocations = 0;
+		uint64_t bytes = 0;
+	};
+
+	// Totals of every allocation made through the global operator new since the start of the program, from any thread
+	[[nodiscard]] AllocationCounts getAllocationCounts();
+}  // namespace MRG::Bench
+
+#endif
@@ -0,0 +1,132 @@
+#include "Benchmark.h"
+
+#include "AllocationCounter.h"
+
+#include <fmt/format.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <numeric>
+
+namespace
+{
+	// Nearest rank percentile, samples must be sorted
+	[[nodiscard]] double percentile(const std::vector<double>& samples, double rank)
+	{
+		const auto index = static_cast<std::size_t>(std::ceil(rank / 100.0 * static_cast<double>(samples.size())));
+		return samples[std::clamp<std::size_t>(index, 1, samples.size()) - 1];
+	}
+
+	void writeSummary(std::ostream& out, const char* name, const MRG::Bench::Summary& summary)
+	{
+		out << fmt::format(R"("{}": {{"mean": {:.6f}, "p50": {:.6f}, "p99": {:.6f}, "min": {:.6f}, "max": {:.6f}}})",
+		                   name,
+		                   summary.mean,
+		                   summary.p50,
+		                   summary.p99,
+		                   summary.min,
+		                   summary.max);
+	}
+}  // namespace
+
+namespace MRG::Bench
+{
+	Summary summarize(std::vector<double> samples)
+	{
+		if (samples.empty()) {
+			return {};
+		}
+
+		std::sort(samples.begin(), samples.end());
+
+		Summary summary;
+		summary.mean = std::accumulate(samples.begin(), samples.end(), 0.0) / static_cast<double>(samples.size());
+		summary.p50 = percentile(samples, 50.0);
+		summary.p99 = percentile(samples, 99.0);
+		summary.min = samples.front();
+		summary.max = samples.back();
+		return summary;
+	}
+
+	WorkloadResult runWorkload(Workload& workload, const BenchmarkSettings& settings)
+	{
+		workload.setup();
+		for (std::size_t i = 0; i < settings.warmupFrames; ++i) { workload.runFrame(); }
+
+		std::vector<double> frameTimes, allocations, allocatedBytes;
+		frameTimes.reserve(settings.frames);
+		allocations.reserve(settings.frames);
+		allocatedBytes.reserve(settings.frames);
+
+		for (std::size_t i = 0; i < settings.frames; ++i) {
+			Renderer2D::resetStats();
+
+			const auto countsBefore = getAllocationCounts();
+			const auto start = std::chrono::steady_clock::now();
+			workload.runFrame();
+			const auto end = std::chrono::steady_clock::now();
+			const auto countsAfter = getAllocationCounts();
+
+			frameTimes.push_back(std::chrono::duration<double, std::milli>(end - start).count());
+			allocations.push_back(static_cast<double>(countsAfter.allocations - countsBefore.allocations));
+			allocatedBytes.push_back(static_cast<double>(countsAfter.bytes - countsBefore.bytes));
+		}
+
+		WorkloadResult result;
+		result.name = workload.getName();
+		result.parameters = workload.getParameters();
+		result.frameTimes = summarize(std::move(frameTimes));
+		result.allocations = summarize(std::move(allocations));
+		result.allocatedBytes = summarize(std::move(allocatedBytes));
+		result.renderingStats = Renderer2D::getStats();
+
+		workload.teardown();
+		return result;
+	}
+
+	void writeJSON(std::ostream& out,
+	               const std::string& renderingAPI,
+	               const BenchmarkSettings& settings,
+	               const std::vector<WorkloadResult>& results)
+	{
+		out << "{\n";
+		out << fmt::format(R"(  "renderingAPI": "{}",)", renderingAPI) << '\n';
+		out << fmt::format(R"(  "frames": {},)", settings.frames) << '\n';
+		out << fmt::format(R"(  "warmupFrames": {},)", settings.warmupFrames) << '\n';
+		out << fmt::format(R"(  "seed": {},)", settings.seed) << '\n';
+		out << fmt::format(R"(  "resolution": [{}, {}],)", settings.width, settings.height) << '\n';
+		out << R"(  "workloads": [)" << '\n';
+
+		for (std::size_t i = 0; i < results.size(); ++i) {
+			const auto& result = results[i];
+
+			out << "    {\n";
+			out << fmt::format(R"(      "name": "{}",)", result.name) << '\n';
+			out << R"(      "parameters": {)";
+			for (std::size_t p = 0; p < result.parameters.size(); ++p) {
+				out << fmt::format(R"({}"{}": {})", (p == 0) ? "" : ", ", result.parameters[p].first, result.parameters[p].second);
+			}
+			out << "},\n";
+
+			out << "      ";
+			writeSummary(out, "frameTimeMs", result.frameTimes);
+			out << ",\n      ";
+			writeSummary(out, "allocationsPerFrame", result.allocations);
+			out << ",\n      ";
+			writeSummary(out, "allocatedBytesPerFrame", result.allocatedBytes);
+			out << ",\n";
+
+			const auto& stats = result.renderingStats;
+			out << fmt::format(R"(      "renderingStats": {{"drawCalls": {}, "quadCount": {}, "culledQuadCount": {}}})",
+			                   stats.drawCalls,
+			                   stats.quadCount,
+			                   stats.culledQuadCount)
+			    << '\n';
+			out << ((i + 1 < results.size()) ? "    },\n" : "    }\n");
+		}
+
+		out << "  ]\n";
+		out << "}\n";
+	}
+}  // namespace MRG::Bench
@@ -0,0 +1,76 @@
+#ifndef MRG_BENCH_BENCHMARK
+#define MRG_BENCH_BENCHMARK
+
+#include "Renderer/Renderer2D.h"
+
+#include <cstdint>
+#include <ostream>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace MRG::Bench
+{
+	struct BenchmarkSettings
+	{
+		std::size_t frames = 100;
+		std::size_t warmupFrames = 10;
+		uint32_t seed = 1;
+		uint32_t width = 1280;
+		uint32_t height = 720;
+	};
+
+	using WorkloadParameters = std::vector<std::pair<std::string, uint64_t>>;
+
+	// Only runFrame is measured, setup and teardown run once before and after all the frames of the workload
+	class Workload
+	{
+	public:
+		Workload() = default;
+		Workload(const Workload&) = delete;
+		Workload(Workload&&) = delete;
+		virtual ~Workload() = default;
+
+		Workload& operator=(const Workload&) = delete;
+		Workload& operator=(Workload&&) = delete;
+
+		[[nodiscard]] virtual std::string getName() const = 0;
+		[[nodiscard]] virtual WorkloadParameters getParameters() const = 0;
+
+		virtual void setup() {}
+		virtual void runFrame() = 0;
+		virtual void teardown() {}
+	};
+
+	struct Summary
+	{
+		double mean = 0.0;
+		double p50 = 0.0;
+		double p99 = 0.0;
+		double min = 0.0;
+		double max = 0.0;
+	};
+
+	[[nodiscard]] Summary summarize(std::vector<double> samples);
+
+	struct WorkloadResult
+	{
+		std::string name;
+		WorkloadParameters parameters;
+
+		Summary frameTimes;  // In milliseconds
+		Summary allocations;
+		Summary allocatedBytes;
+		// Statistics of the last measured frame
+		RenderingStatistics renderingStats;
+	};
+
+	[[nodiscard]] WorkloadResult runWorkload(Workload& workload, const BenchmarkSettings& settings);
+
+	void writeJSON(std::ostream& out,
+	               const std::string& renderingAPI,
+	               const BenchmarkSettings& settings,
+	               const std::vector<WorkloadResult>& results);
+}  // namespace MRG::Bench
+
+#endif
@@ -0,0 +1,241 @@
+#include "Workloads.h"
+
+#include "Renderer/Renderer2D.h"
+#include "Scene/Components.h"
+#include "Scene/SceneGenerator.h"
+#include "Scene/SceneSerializer.h"
+
+#include <fmt/format.h>
+
+#include <array>
+#include <cmath>
+#include <filesystem>
+
+namespace
+{
+	// Sprites are spread over a square whose area grows with their count, so that the density stays the same across sizes
+	[[nodiscard]] float getSceneExtent(uint32_t spriteCount) { return std::sqrt(static_cast<float>(spriteCount)); }
+
+	MRG::Entity createSprite(MRG::Scene& scene, MRG::Random& random, float extent)
+	{
+		auto entity = scene.createEntity("Sprite");
+
+		auto& transform = entity.getComponent<MRG::TransformComponent>();
+		transform.setTranslation({random.nextFloat(-extent, extent), random.nextFloat(-extent, extent), random.nextFloat(-0.5f, 0.5f)});
+		transform.setRotation({0.f, 0.f, glm::radians(random.nextFloat(0.f, 360.f))});
+		transform.setScale({random.nextFloat(0.5f, 1.5f), random.nextFloat(0.5f, 1.5f), 1.f});
+
+		auto& sprite = entity.addComponent<MRG::SpriteRendererComponent>();
+		sprite.color = {random.nextFloat(), random.nextFloat(), random.nextFloat(), random.nextFloat(0.5f, 1.f)};
+
+		return entity;
+	}
+
+	// The camera only covers the central area of the scene vertically, so that part of the sprites end up culled
+	void createCamera(MRG::Scene& scene, const MRG::Bench::BenchmarkSettings& settings, float extent)
+	{
+		scene.onViewportResize(settings.width, settings.height);
+
+		auto& camera = scene.createEntity("Camera").addComponent<MRG::CameraComponent>();
+		camera.camera.setOrthographic(extent, -1.f, 1.f);
+	}
+
+	[[nodiscard]] std::string getTemporaryScenePath(const std::string& name, uint32_t entityCount)
+	{
+		const auto filename = fmt::format("MorriguBench_{}_{}.morrigu", name, entityCount);
+		return (std::filesystem::temp_directory_path() / filename).string();
+	}
+
+	[[nodiscard]] MRG::Ref<MRG::Scene> createSpriteScene(const MRG::Bench::BenchmarkSettings& settings, uint32_t spriteCount)
+	{
+		MRG::SceneGenerationSpec spec;
+		spec.seed = settings.seed;
+		spec.entityCount = spriteCount;
+		spec.extent = getSceneExtent(spriteCount);
+		// Like createCamera, so that part of the sprites end up culled
+		spec.cameraSize = spec.extent;
+
+		auto scene = MRG::SceneGenerator{spec}.generate();
+		scene->onViewportResize(settings.width, settings.height);
+		return scene;
+	}
+
+	void renderScene(MRG::Scene& scene)
+	{
+		if (MRG::Renderer2D::beginFrame()) {
+			MRG::Renderer2D::clear();
+			scene.onUpdate(MRG::Timestep{1.f / 60.f});
+			MRG::Renderer2D::endFrame();
+		}
+	}
+}  // namespace
+
+namespace MRG::Bench
+{
+	SpriteSceneWorkload::SpriteSceneWorkload(const BenchmarkSettings& settings, uint32_t spriteCount)
+	    : m_settings(settings), m_spriteCount(spriteCount)
+	{}
+
+	void SpriteSceneWorkload::setup()
+	{
+		m_scene = createSpriteScene(m_settings, m_spriteCount);
+	}
+
+	void SpriteSceneWorkload::runFrame() { renderScene(*m_scene); }
+
+	void SpriteSceneWorkload::teardown() { m_scene.reset(); }
+
+	TextureDiversityWorkload::TextureDiversityWorkload(const BenchmarkSettings& settings, uint32_t quadCount, uint32_t textureCount)
+	    : m_settings(settings), m_quadCount(quadCount), m_textureCount(textureCount)
+	{}
+
+	void TextureDiversityWorkload::setup()
+	{
+		Random random{m_settings.seed};
+		const auto extent = getSceneExtent(m_quadCount);
+		const auto aspectRatio = static_cast<float>(m_settings.width) / static_cast<float>(m_settings.height);
+		m_camera.setProjection(glm::ortho(-extent * aspectRatio, extent * aspectRatio, -extent, extent, -1.f, 1.f));
+
+		m_transforms.reserve(m_quadCount);
+		for (uint32_t i = 0; i < m_quadCount; ++i) {
+			const glm::vec3 position{random.nextFloat(-extent, extent), random.nextFloat(-extent, extent), 0.f};
+			m_transforms.emplace_back(glm::translate(glm::mat4{1.f}, position));
+		}
+
+		m_textures.reserve(m_textureCount);
+		for (uint32_t i = 0; i < m_textureCount; ++i) {
+			static constexpr uint32_t textureSize = 4;
+			std::array<uint32_t, textureSize * textureSize> pixels{};
+			for (auto& pixel : pixels) { pixel = 0xff000000 | (random.nextUint(0x01000000)); }
+
+			auto texture = Texture2D::create(textureSize, textureSize);
+			texture->setData(pixels.data(), static_cast<uint32_t>(pixels.size() * sizeof(uint32_t)));
+			m_textures.emplace_back(std::move(texture));
+		}
+	}
+
+	void TextureDiversityWorkload::runFrame()
+	{
+		if (!Renderer2D::beginFrame()) {
+			return;
+		}
+
+		Renderer2D::clear();
+		Renderer2D::beginScene(m_camera, glm::mat4{1.f});
+		for (uint32_t i = 0; i < m_quadCount; ++i) { Renderer2D::drawQuad(m_transforms[i], m_textures[i % m_textureCount]); }
+		Renderer2D::endScene();
+		Renderer2D::endFrame();
+	}
+
+	void TextureDiversityWorkload::teardown()
+	{
+		for (auto& texture : m_textures) { texture->destroy(); }
+		m_textures.clear();
+		m_transforms.clear();
+	}
+
+	SerializerSaveWorkload::SerializerSaveWorkload(const BenchmarkSettings& settings, uint32_t entityCount)
+	    : m_settings(settings), m_entityCount(entityCount)
+	{}
+
+	void SerializerSaveWorkload::setup()
+	{
+		m_filepath = getTemporaryScenePath(getName(), m_entityCount);
+		m_scene = createSpriteScene(m_settings, m_entityCount);
+	}
+
+	void SerializerSaveWorkload::runFrame()
+	{
+		SceneSerializer serializer{m_scene};
+		serializer.serialize(m_filepath);
+	}
+
+	void SerializerSaveWorkload::teardown()
+	{
+		m_scene.reset();
+		std::error_code error;
+		std::filesystem::remove(m_filepath, error);
+	}
+
+	SerializerLoadWorkload::SerializerLoadWorkload(const BenchmarkSettings& settings, uint32_t entityCount)
+	    : m_settings(settings), m_entityCount(entityCount)
+	{}
+
+	void SerializerLoadWorkload::setup()
+	{
+		m_filepath = getTemporaryScenePath(getName(), m_entityCount);
+
+		SceneSerializer serializer{createSpriteScene(m_settings, m_entityCount)};
+		serializer.serialize(m_filepath);
+	}
+
+	void SerializerLoadWorkload::runFrame()
+	{
+		auto scene = createRef<Scene>();
+		SceneSerializer serializer{scene};
+		[[maybe_unused]] const auto success = serializer.deserialize(m_filepath);
+		MRG_CORE_ASSERT(success, "Failed to deserialize the benchmark scene!")
+	}
+
+	void SerializerLoadWorkload::teardown()
+	{
+		std::error_code error;
+		std::filesystem::remove(m_filepath, error);
+	}
+
+	EntityChurnWorkload::EntityChurnWorkload(const BenchmarkSettings& settings, uint32_t entityCount, uint32_t churnCount)
+	    : m_settings(settings), m_entityCount(entityCount), m_churnCount(churnCount), m_random(settings.seed)
+	{}
+
+	void EntityChurnWorkload::setup()
+	{
+		SceneGenerationSpec spec;
+		spec.seed = m_settings.seed;
+		spec.entityCount = m_entityCount;
+		spec.extent = getSceneExtent(m_entityCount);
+
+		m_random = Random{m_settings.seed};
+		m_scene = createRef<Scene>();
+		createCamera(*m_scene, m_settings, spec.extent);
+		m_entities = SceneGenerator{spec}.populate(*m_scene);
+	}
+
+	void EntityChurnWorkload::runFrame()
+	{
+		const auto extent = getSceneExtent(m_entityCount);
+		for (uint32_t i = 0; i < m_churnCount; ++i) {
+			auto& entity = m_entities[m_random.nextUint(m_entityCount)];
+			m_scene->destroyEntity(entity);
+			entity = createSprite(*m_scene, m_random, extent);
+		}
+
+		renderScene(*m_scene);
+	}
+
+	void EntityChurnWorkload::teardown()
+	{
+		m_entities.clear();
+		m_scene.reset();
+	}
+
+	std::vector<Scope<Workload>> createWorkloads(const BenchmarkSettings& settings)
+	{
+		std::vector<Scope<Workload>> workloads;
+
+		for (const uint32_t spriteCount : {1'000u, 10'000u, 100'000u, 1'000'000u}) {
+			workloads.emplace_back(createScope<SpriteSceneWorkload>(settings, spriteCount));
+		}
+		for (const uint32_t textureCount : {1u, 4u, 16u, 32u, 64u, 256u}) {
+			workloads.emplace_back(createScope<TextureDiversityWorkload>(settings, 100'000u, textureCount));
+		}
+		for (const uint32_t entityCount : {1'000u, 10'000u}) {
+			workloads.emplace_back(createScope<SerializerSaveWorkload>(settings, entityCount));
+			workloads.emplace_back(createScope<SerializerLoadWorkload>(settings, entityCount));
+		}
+		for (const uint32_t churnCount : {1'000u, 10'000u}) {
+			workloads.emplace_back(createScope<EntityChurnWorkload>(settings, 100'000u, churnCount));
+		}
+
+		return workloads;
+	}
+}  // namespace MRG::Bench
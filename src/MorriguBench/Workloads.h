@@ -0,0 +1,125 @@
+#ifndef MRG_BENCH_WORKLOADS
+#define MRG_BENCH_WORKLOADS
+
+#include "Benchmark.h"
+
+#include "Core/Core.h"
+#include "Core/Random.h"
+#include "Renderer/Camera.h"
+#include "Renderer/Textures.h"
+#include "Scene/Entity.h"
+#include "Scene/Scene.h"
+
+namespace MRG::Bench
+{
+	// Renders a scene of randomly placed sprites through Scene::onUpdate, using its primary camera
+	class SpriteSceneWorkload : public Workload
+	{
+	public:
+		SpriteSceneWorkload(const BenchmarkSettings& settings, uint32_t spriteCount);
+
+		[[nodiscard]] std::string getName() const override { return "SpriteScene"; }
+		[[nodiscard]] WorkloadParameters getParameters() const override { return {{"sprites", m_spriteCount}}; }
+
+		void setup() override;
+		void runFrame() override;
+		void teardown() override;
+
+	private:
+		BenchmarkSettings m_settings;
+		uint32_t m_spriteCount;
+		Ref<Scene> m_scene;
+	};
+
+	// Renders textured quads cycling through a number of distinct textures, to measure the cost of batch breaks
+	class TextureDiversityWorkload : public Workload
+	{
+	public:
+		TextureDiversityWorkload(const BenchmarkSettings& settings, uint32_t quadCount, uint32_t textureCount);
+
+		[[nodiscard]] std::string getName() const override { return "TextureDiversity"; }
+		[[nodiscard]] WorkloadParameters getParameters() const override
+		{
+			return {{"quads", m_quadCount}, {"textures", m_textureCount}};
+		}
+
+		void setup() override;
+		void runFrame() override;
+		void teardown() override;
+
+	private:
+		BenchmarkSettings m_settings;
+		uint32_t m_quadCount;
+		uint32_t m_textureCount;
+		Camera m_camera;
+		std::vector<glm::mat4> m_transforms;
+		std::vector<Ref<Texture2D>> m_textures;
+	};
+
+	class SerializerSaveWorkload : public Workload
+	{
+	public:
+		SerializerSaveWorkload(const BenchmarkSettings& settings, uint32_t entityCount);
+
+		[[nodiscard]] std::string getName() const override { return "SerializerSave"; }
+		[[nodiscard]] WorkloadParameters getParameters() const override { return {{"entities", m_entityCount}}; }
+
+		void setup() override;
+		void runFrame() override;
+		void teardown() override;
+
+	private:
+		BenchmarkSettings m_settings;
+		uint32_t m_entityCount;
+		std::string m_filepath;
+		Ref<Scene> m_scene;
+	};
+
+	// Each frame deserializes the file into a brand new scene
+	class SerializerLoadWorkload : public Workload
+	{
+	public:
+		SerializerLoadWorkload(const BenchmarkSettings& settings, uint32_t entityCount);
+
+		[[nodiscard]] std::string getName() const override { return "SerializerLoad"; }
+		[[nodiscard]] WorkloadParameters getParameters() const override { return {{"entities", m_entityCount}}; }
+
+		void setup() override;
+		void runFrame() override;
+		void teardown() override;
+
+	private:
+		BenchmarkSettings m_settings;
+		uint32_t m_entityCount;
+		std::string m_filepath;
+	};
+
+	// Each frame destroys and recreates churnCount random sprites out of the entityCount ones of the scene
+	class EntityChurnWorkload : public Workload
+	{
+	public:
+		EntityChurnWorkload(const BenchmarkSettings& settings, uint32_t entityCount, uint32_t churnCount);
+
+		[[nodiscard]] std::string getName() const override { return "EntityChurn"; }
+		[[nodiscard]] WorkloadParameters getParameters() const override
+		{
+			return {{"entities", m_entityCount}, {"churn", m_churnCount}};
+		}
+
+		void setup() override;
+		void runFrame() override;
+		void teardown() override;
+
+	private:
+		BenchmarkSettings m_settings;
+		uint32_t m_entityCount;
+		uint32_t m_churnCount;
+		Random m_random;
+		Ref<Scene> m_scene;
+		std::vector<Entity> m_entities;
+	};
+
+	[[nodiscard]] std::vector<Scope<Workload>> createWorkloads(const BenchmarkSettings& settings);
+}  // namespace MRG::Bench
+
+#endif
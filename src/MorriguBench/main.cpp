@@ -0,0 +1,182 @@
+// This executable provides its own entry point instead of the one of the engine, so Core/Application.h (and Morrigu.h) must not be
+// included here. As the engine is a static library, its main is never pulled in at link time.
+#include "Benchmark.h"
+#include "Workloads.h"
+
+#include "Core/Logger.h"
+#include "Renderer/Renderer2D.h"
+#include "Renderer/RenderingAPI.h"
+#include "Scene/SceneGenerator.h"
+
+#include <fstream>
+#include <iostream>
+#include <optional>
+
+namespace
+{
+	struct CommandLine
+	{
+		MRG::RenderingAPI::API api = MRG::RenderingAPI::API::Null;
+		std::string apiName = "null";
+		std::string filter;
+		std::string outputPath;
+		MRG::Bench::BenchmarkSettings settings;
+
+		// When set, a scene is generated into this file instead of running the benchmarks
+		std::string generatePath;
+		MRG::SceneGenerationSpec generation;
+	};
+
+	void printUsage()
+	{
+		std::cerr << "Usage: MorriguBench [options]\n"
+		             "       MorriguBench --generate <path> [generation options]\n"
+		             "\n"
+		             "Options:\n"
+		             "  --api <null|software>  Rendering API used by the renderer (default: null)\n"
+		             "  --frames <count>       Number of measured frames per workload (default: 100)\n"
+		             "  --warmup <count>       Number of unmeasured frames run before measuring (default: 10)\n"
+		             "  --seed <seed>          Seed used to generate the scenes (default: 1)\n"
+		             "  --filter <text>        Only run the workloads whose name contains this text\n"
+		             "  --output <path>        Write the JSON report to this file instead of the standard output\n"
+		             "\n"
+		             "Generation options:\n"
+		             "  --seed <seed>          Seed used to generate the scene (default: 1)\n"
+		             "  --entities <count>     Number of entities, cameras excluded (default: 1000)\n"
+		             "  --sprite-ratio <ratio> Fraction of the entities with a sprite (default: 1)\n"
+		             "  --cameras <count>      Number of cameras, the first one being the primary one (default: 1)\n"
+		             "  --distribution <name>  uniform, grid or clustered (default: uniform)\n"
+		             "  --extent <size>        Half size of the area the entities are placed in (default: sqrt(entities))\n"
+		             "  --clusters <count>     Number of clusters of the clustered distribution (default: 16)\n"
+		             "  --depth <depth>        Depth of the entity trees, 1 meaning no hierarchy (default: 1)\n"
+		             "  --children <count>     Number of children per entity in the trees (default: 4)\n";
+	}
+
+	[[nodiscard]] std::optional<CommandLine> parseCommandLine(int argc, char** argv)
+	{
+		CommandLine commandLine;
+
+		for (int i = 1; i < argc; ++i) {
+			const std::string argument{argv[i]};
+			if (argument == "--help") {
+				return std::nullopt;
+			}
+			if (i + 1 >= argc) {
+				std::cerr << "Missing value for argument " << argument << '\n';
+				return std::nullopt;
+			}
+			const std::string value{argv[++i]};
+
+			try {
+				if (argument == "--api") {
+					if (value == "null") {
+						commandLine.api = MRG::RenderingAPI::API::Null;
+					} else if (value == "software") {
+						commandLine.api = MRG::RenderingAPI::API::Software;
+					} else {
+						std::cerr << "Unsupported rendering API " << value << " (the benchmarks run headless)\n";
+						return std::nullopt;
+					}
+					commandLine.apiName = value;
+				} else if (argument == "--frames") {
+					commandLine.settings.frames = std::stoul(value);
+				} else if (argument == "--warmup") {
+					commandLine.settings.warmupFrames = std::stoul(value);
+				} else if (argument == "--seed") {
+					commandLine.settings.seed = static_cast<uint32_t>(std::stoul(value));
+					commandLine.generation.seed = commandLine.settings.seed;
+				} else if (argument == "--filter") {
+					commandLine.filter = value;
+				} else if (argument == "--output") {
+					commandLine.outputPath = value;
+				} else if (argument == "--generate") {
+					commandLine.generatePath = value;
+				} else if (argument == "--entities") {
+					commandLine.generation.entityCount = static_cast<uint32_t>(std::stoul(value));
+				} else if (argument == "--sprite-ratio") {
+					commandLine.generation.spriteRatio = std::stof(value);
+				} else if (argument == "--cameras") {
+					commandLine.generation.cameraCount = static_cast<uint32_t>(std::stoul(value));
+				} else if (argument == "--distribution") {
+					if (value == "uniform") {
+						commandLine.generation.distribution = MRG::SpatialDistribution::Uniform;
+					} else if (value == "grid") {
+						commandLine.generation.distribution = MRG::SpatialDistribution::Grid;
+					} else if (value == "clustered") {
+						commandLine.generation.distribution = MRG::SpatialDistribution::Clustered;
+					} else {
+						std::cerr << "Unknown spatial distribution " << value << '\n';
+						return std::nullopt;
+					}
+				} else if (argument == "--extent") {
+					commandLine.generation.extent = std::stof(value);
+				} else if (argument == "--clusters") {
+					commandLine.generation.clusterCount = static_cast<uint32_t>(std::stoul(value));
+				} else if (argument == "--depth") {
+					commandLine.generation.hierarchyDepth = static_cast<uint32_t>(std::stoul(value));
+				} else if (argument == "--children") {
+					commandLine.generation.childrenPerEntity = static_cast<uint32_t>(std::stoul(value));
+				} else {
+					std::cerr << "Unknown argument " << argument << '\n';
+					return std::nullopt;
+				}
+			} catch (const std::exception&) {
+				std::cerr << "Invalid value " << value << " for argument " << argument << '\n';
+				return std::nullopt;
+			}
+		}
+
+		return commandLine;
+	}
+}  // namespace
+
+int main(int argc, char** argv)
+{
+	const auto commandLine = parseCommandLine(argc, argv);
+	if (!commandLine) {
+		printUsage();
+		return 1;
+	}
+	const auto& settings = commandLine->settings;
+
+	// The report may be written to the standard output, so the logs are kept to a minimum
+	MRG::Logger::init();
+	MRG::Logger::getEngineLogger()->set_level(spdlog::level::warn);
+	MRG::Logger::getClientLogger()->set_level(spdlog::level::warn);
+
+	if (!commandLine->generatePath.empty()) {
+		MRG::SceneGenerator{commandLine->generation}.generateToFile(commandLine->generatePath);
+		return 0;
+	}
+
+	MRG::RenderingAPI::setAPI(commandLine->api);
+	MRG::Renderer2D::init(nullptr);
+	MRG::Renderer2D::onWindowResize(settings.width, settings.height);
+
+	std::vector<MRG::Bench::WorkloadResult> results;
+	for (const auto& workload : MRG::Bench::createWorkloads(settings)) {
+		if (workload->getName().find(commandLine->filter) == std::string::npos) {
+			continue;
+		}
+
+		std::cerr << "Running " << workload->getName();
+		for (const auto& [name, value] : workload->getParameters()) { std::cerr << ' ' << name << '=' << value; }
+		std::cerr << '\n';
+
+		results.emplace_back(MRG::Bench::runWorkload(*workload, settings));
+	}
+
+	if (commandLine->outputPath.empty()) {
+		MRG::Bench::writeJSON(std::cout, commandLine->apiName, settings, results);
+	} else {
+		std::ofstream output{commandLine->outputPath};
+		if (!output) {
+			std::cerr << "Could not open " << commandLine->outputPath << " for writing\n";
+			MRG::Renderer2D::shutdown();
+			return 1;
+		}
+		MRG::Bench::writeJSON(output, commandLine->apiName, settings, results);
+	}
+
+	MRG::Renderer2D::shutdown();
+}
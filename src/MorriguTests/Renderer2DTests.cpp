@@ -0,0 +1,85 @@
+#include "TestRunner.h"
+
+#include "Renderer/APIs/Software/Framebuffer.h"
+#include "Renderer/Camera.h"
+#include "Renderer/Renderer2D.h"
+
+#include <array>
+
+namespace
+{
+	const uint32_t targetSize = 16;
+
+	[[nodiscard]] MRG::Ref<MRG::Software::Framebuffer> createTarget()
+	{
+		MRG::FramebufferSpecification specification{};
+		specification.width = targetSize;
+		specification.height = targetSize;
+		specification.attachments = {MRG::FramebufferTextureFormat::RGBA8, MRG::FramebufferTextureFormat::Depth};
+
+		return std::static_pointer_cast<MRG::Software::Framebuffer>(MRG::Framebuffer::create(specification));
+	}
+
+	[[nodiscard]] MRG::Camera createCamera()
+	{
+		MRG::Camera camera;
+		camera.setProjection(glm::ortho(-1.f, 1.f, -1.f, 1.f, -1.f, 1.f));
+		return camera;
+	}
+
+	// Covers the whole target with the camera of createCamera
+	const glm::mat4 fullTargetTransform = glm::scale(glm::mat4{1.f}, {2.f, 2.f, 1.f});
+}  // namespace
+
+MRG_TEST(changingTargetAfterABatchFlushKeepsQuadsOnTheirTarget)
+{
+	auto firstTarget = createTarget();
+	auto secondTarget = createTarget();
+
+	MRG::Renderer2D::setRenderTarget(firstTarget);
+	MRG::Renderer2D::beginScene(createCamera(), glm::mat4{1.f});
+
+	// Fills the first batch with quads out of view, so that the next one starts a new batch in the middle of the scene
+	const auto hiddenTransform = glm::translate(glm::mat4{1.f}, {10.f, 10.f, 0.f});
+	for (uint32_t i = 0; i < MRG::Generic2DRenderer::maxQuads; ++i) { MRG::Renderer2D::drawQuad(hiddenTransform, glm::vec4{1.f}, 0); }
+	MRG::Renderer2D::drawQuad(fullTargetTransform, glm::vec4{1.f}, 42);
+
+	MRG::Renderer2D::setRenderTarget(secondTarget);
+	MRG::Renderer2D::endScene();
+	MRG::Renderer2D::resetRenderTarget();
+
+	MRG_CHECK(firstTarget->getObjectIDAt(targetSize / 2, targetSize / 2) == 42)
+	MRG_CHECK(secondTarget->getObjectIDAt(targetSize / 2, targetSize / 2) == MRG::Software::Framebuffer::noObjectID)
+
+	firstTarget->destroy();
+	secondTarget->destroy();
+}
+
+MRG_TEST(deferredTexturedQuadsKeepTheirObjectIDs)
+{
+	auto target = createTarget();
+	auto texture = MRG::Texture2D::create(1, 1);
+	auto textureData = 0xffffffff;
+	texture->setData(&textureData, sizeof(textureData));
+
+	// One quad on each half of the target
+	const std::array<glm::mat4, 2> transforms = {
+	  glm::translate(glm::mat4{1.f}, {-0.5f, 0.f, 0.f}) * glm::scale(glm::mat4{1.f}, {1.f, 2.f, 1.f}),
+	  glm::translate(glm::mat4{1.f}, {0.5f, 0.f, 0.f}) * glm::scale(glm::mat4{1.f}, {1.f, 2.f, 1.f})};
+	const std::array<glm::vec4, 2> colors = {glm::vec4{1.f}, glm::vec4{1.f}};
+	const std::array<uint32_t, 2> objectIDs = {7, 13};
+
+	MRG::Renderer2D::setQuadSubmissionMode(MRG::QuadSubmissionMode::Deferred);
+	MRG::Renderer2D::setRenderTarget(target);
+	MRG::Renderer2D::beginScene(createCamera(), glm::mat4{1.f});
+	MRG::Renderer2D::drawQuads(transforms, texture, 1.f, colors, objectIDs);
+	MRG::Renderer2D::endScene();
+	MRG::Renderer2D::resetRenderTarget();
+	MRG::Renderer2D::setQuadSubmissionMode(MRG::QuadSubmissionMode::Immediate);
+
+	MRG_CHECK(target->getObjectIDAt(targetSize / 4, targetSize / 2) == 7)
+	MRG_CHECK(target->getObjectIDAt(3 * targetSize / 4, targetSize / 2) == 13)
+
+	texture->destroy();
+	target->destroy();
+}
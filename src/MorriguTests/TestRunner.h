@@ -0,0 +1,35 @@
+#ifndef MRG_TESTS_TESTRUNNER
+#define MRG_TESTS_TESTRUNNER
+
+#include <vector>
+
+namespace MRG::Tests
+{
+	struct TestCase
+	{
+		const char* name;
+		void (*function)();
+	};
+
+	[[nodiscard]] std::vector<TestCase>& getTestCases();
+	void reportFailure(const char* file, int line, const char* expression);
+
+	struct TestRegistration
+	{
+		TestRegistration(const char* name, void (*function)()) { getTestCases().push_back({name, function}); }
+	};
+}  // namespace MRG::Tests
+
+// Defines a test case, registered before main runs
+#define MRG_TEST(name)                                                                                                                     \
+	static void name();                                                                                                                    \
+	static const ::MRG::Tests::TestRegistration name##Registration{#name, name};                                                          \
+	static void name()
+
+// Reports the failure and carries on with the rest of the test case
+#define MRG_CHECK(condition)                                                                                                               \
+	if (!(condition)) {                                                                                                                    \
+		::MRG::Tests::reportFailure(__FILE__, __LINE__, #condition);                                                                       \
+	}
+
+#endif
@@ -0,0 +1,56 @@
+// Like MorriguBench, this executable provides its own entry point, so Core/Application.h (and Morrigu.h) must not be included here.
+// The tests run headless, on the software renderer so that they can read back what was rendered.
+#include "TestRunner.h"
+
+#include "Core/Logger.h"
+#include "Renderer/Renderer2D.h"
+#include "Renderer/RenderingAPI.h"
+
+#include <iostream>
+
+namespace
+{
+	int s_failureCount = 0;
+}  // namespace
+
+namespace MRG::Tests
+{
+	std::vector<TestCase>& getTestCases()
+	{
+		static std::vector<TestCase> testCases;
+		return testCases;
+	}
+
+	void reportFailure(const char* file, int line, const char* expression)
+	{
+		std::cerr << file << ':' << line << ": check failed: " << expression << '\n';
+		++s_failureCount;
+	}
+}  // namespace MRG::Tests
+
+int main()
+{
+	MRG::Logger::init();
+	MRG::Logger::getEngineLogger()->set_level(spdlog::level::warn);
+	MRG::Logger::getClientLogger()->set_level(spdlog::level::warn);
+
+	MRG::RenderingAPI::setAPI(MRG::RenderingAPI::API::Software);
+	MRG::Renderer2D::init(nullptr);
+
+	int failedTestCount = 0;
+	for (const auto& testCase : MRG::Tests::getTestCases()) {
+		const auto previousFailureCount = s_failureCount;
+		testCase.function();
+
+		const auto passed = (s_failureCount == previousFailureCount);
+		std::cerr << (passed ? "[PASS] " : "[FAIL] ") << testCase.name << '\n';
+		if (!passed) {
+			++failedTestCount;
+		}
+	}
+
+	MRG::Renderer2D::shutdown();
+
+	std::cerr << failedTestCount << " of " << MRG::Tests::getTestCases().size() << " tests failed\n";
+	return (failedTestCount == 0) ? 0 : 1;
+}